@@ -1,16 +1,27 @@
+#include "../Entities/EntityTransforms.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
+#include "../Utilities/SpriteCache.h"
+#include "SimulationThread.h"
 
 #include <openrct2/Context.h>
 #include <openrct2/Diagnostic.h>
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/core/Path.hpp>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/EntityTweener.h>
 #include <openrct2/scenes/Scene.h>
+#include <openrct2/world/MapChanges.h>
 #include <openrct2/world/Park.h>
 
+#include <algorithm>
+
 std::unique_ptr<IContext> unityContext;
 
+// Real time in seconds that has not been consumed by a fixed simulation tick yet.
+static float _ticksAccumulator = 0.0f;
+
 extern "C"
 {
     EXPORT void StartGame(const char* datapath, const char* rct2path, const char* rct1path)
@@ -41,22 +52,108 @@ extern "C"
         unityContext = CreateContext(); // OpenRCT2::CreateContext()
         bool result = unityContext->Initialise();
 
+        // Let the host refresh only the tiles that changed after each update
+        MapChangesSetEnabled(true);
+
         dll_log("Initialise = %i", result);
     }
 
     EXPORT void PerformGameUpdate()
     {
+        if (SimulationThreadIsRunning())
+            return;
+
+        // Put back any interpolated positions left by a previous stepped update
+        EntityTweener& tweener = EntityTweener::Get();
+        tweener.Restore();
+        tweener.Reset();
+
         unityContext->GetActiveScene()->Tick();
+        PublishEntityTransforms();
+    }
+
+    // Advances the simulation by the elapsed real time in fixed ticks, running at most 'maxTicks'
+    // ticks per call, and returns the interpolation alpha between the last two ticks.
+    EXPORT float PerformGameUpdateFor(float elapsedSeconds, int32_t maxTicks)
+    {
+        if (SimulationThreadIsRunning())
+            return 0.0f;
+
+        EntityTweener& tweener = EntityTweener::Get();
+        const float maxThreshold = kGameUpdateTimeMS * std::max(maxTicks, 1);
+
+        _ticksAccumulator = std::clamp(_ticksAccumulator + elapsedSeconds, 0.0f, maxThreshold);
+
+        int32_t ticks = 0;
+        while (_ticksAccumulator >= kGameUpdateTimeMS && ticks < maxTicks)
+        {
+            tweener.PreTick();
+            unityContext->GetActiveScene()->Tick();
+            tweener.PostTick();
+
+            _ticksAccumulator -= kGameUpdateTimeMS;
+            ticks++;
+        }
+
+        const float alpha = std::min(_ticksAccumulator / kGameUpdateTimeMS, 1.0f);
+        tweener.Tween(alpha);
+
+        PublishEntityTransforms();
+        return alpha;
+    }
+
+    // Moves the simulation onto a background thread that ticks on its own clock. Entity transforms
+    // keep being published after every tick, exports reading other live game state hold the
+    // simulation lock themselves.
+    EXPORT void StartSimulationThread()
+    {
+        if (unityContext == nullptr || SimulationThreadIsRunning())
+            return;
+
+        // The thread ticks without the tweener, so put back any interpolated positions first
+        {
+            std::lock_guard lock(GetSimulationMutex());
+            EntityTweener& tweener = EntityTweener::Get();
+            tweener.Restore();
+            tweener.Reset();
+        }
+
+        SimulationThreadStart();
+    }
+
+    // Stops the background simulation thread, after which the host drives the updates again. Returns
+    // false without stopping while the simulation is locked by the host.
+    EXPORT bool StopSimulationThread()
+    {
+        return SimulationThreadStop();
+    }
+
+    // Pauses the background simulation between two ticks, so live game state can be read safely.
+    EXPORT void LockSimulation()
+    {
+        SimulationHostLock();
+    }
+
+    EXPORT void UnlockSimulation()
+    {
+        SimulationHostUnlock();
     }
 
     EXPORT void StopGame()
     {
         dll_log("StopGame()");
 
+        // The game is going away, so any lock the host still holds is released instead of deadlocking
+        SimulationHostUnlockAll();
+        SimulationThreadStop();
+
         if (unityContext != nullptr)
         {
             unityContext->Finish();
             unityContext = nullptr;
+            _ticksAccumulator = 0.0f;
+            MapChangesSetEnabled(false);
+            EntityLifecycleSetEnabled(false);
         }
     }
 
@@ -70,15 +167,22 @@ extern "C"
     EXPORT void LoadPark(const char* filepath)
     {
         dll_log("LoadPark( %s )", filepath);
+        std::lock_guard lock(GetSimulationMutex());
+
+        // Object images may be reassigned by the new park
+        SpriteCachePurge();
+        _ticksAccumulator = 0.0f;
 
         unityContext->LoadParkFromFile(std::string(filepath));
         unityContext->SetActiveScene(unityContext->GetGameScene());
+        PublishEntityTransforms();
 
         dll_log("LoadPark() = %s", GetActiveParkName());
     }
 
     EXPORT const char* GetParkName()
     {
+        std::lock_guard lock(GetSimulationMutex());
         const char* name = GetActiveParkName();
         dll_log("GetParkName() = %s", name);
         return name;
@@ -1,7 +1,13 @@
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
+#include "../Utilities/SpriteCache.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <openrct2/core/JobPool.h>
 #include <openrct2/drawing/Drawing.h>
+#include <vector>
 
 extern "C"
 {
@@ -48,9 +54,8 @@ extern "C"
         data->y_offset = g1->y_offset;
     }
 
-    // Returns the actual texture data based on the image index.
-    EXPORT void GetTexturePixels(
-        uint32_t imageIndex, uint8_t colour1, uint8_t colour2, uint8_t colour3, uint8_t* pixels, int length)
+    // Combines the image index with the optional remap colours.
+    static ImageId GetColouredImageId(uint32_t imageIndex, uint8_t colour1, uint8_t colour2, uint8_t colour3)
     {
         auto imageId = ImageId(imageIndex & 0x7FFFF);
         if (colour1 != COLOUR_NULL)
@@ -65,23 +70,24 @@ extern "C"
         {
             imageId = imageId.WithTertiary(colour3);
         }
-        const G1Element* g1 = GfxGetG1Element(imageId);
+        return imageId;
+    }
 
+    // Renders the sprite and flips it up-side-down, which is the row order the host expects.
+    static bool DecodeSprite(const ImageId imageId, std::vector<uint8_t>& pixels)
+    {
+        const G1Element* g1 = GfxGetG1Element(imageId);
         if (g1 == nullptr)
         {
-            dll_log("Could not find g1 element pixels for %i (combined: %i).", imageIndex, imageId.ToUInt32());
-            return;
+            return false;
         }
 
         uint16_t width = g1->width;
         uint16_t height = g1->height;
-        size_t numPixels = (size_t)width * height;
-
-        auto bits = new uint8_t[numPixels];
-        std::fill_n(bits, numPixels, 0);
+        pixels.assign(static_cast<size_t>(width) * height, 0);
 
         DrawPixelInfo dpi;
-        dpi.bits = bits;
+        dpi.bits = pixels.data();
         dpi.x = g1->x_offset;
         dpi.y = g1->y_offset;
         dpi.width = width;
@@ -92,12 +98,194 @@ extern "C"
         GfxDrawSpriteSoftware(dpi, imageId, { 0, 0 });
 
         // Flip the render up-side-down
-        int lastRow = (height - 1);
-        for (int y = 0; y <= lastRow; y++)
+        for (int y = 0; y < height / 2; y++)
+        {
+            uint8_t* top = pixels.data() + static_cast<size_t>(y) * width;
+            uint8_t* bottom = pixels.data() + static_cast<size_t>(height - 1 - y) * width;
+            std::swap_ranges(top, top + width, bottom);
+        }
+        return true;
+    }
+
+    // Returns the actual texture data based on the image index.
+    EXPORT void GetTexturePixels(
+        uint32_t imageIndex, uint8_t colour1, uint8_t colour2, uint8_t colour3, uint8_t* pixels, int length)
+    {
+        const ImageId imageId = GetColouredImageId(imageIndex, colour1, colour2, colour3);
+
+        if (!SpriteCacheCopy(imageId, pixels, length, DecodeSprite))
+        {
+            dll_log("Could not find g1 element pixels for %i (combined: %i).", imageIndex, imageId.ToUInt32());
+        }
+    }
+
+    // Writes the hit and miss counters and the current size of the sprite cache to the specified struct.
+    EXPORT void GetSpriteCacheStats(SpriteCacheStats* stats)
+    {
+        *stats = SpriteCacheGetStats();
+    }
+
+    // Sets the maximum amount of pixel bytes the sprite cache may hold.
+    EXPORT void SetSpriteCacheCapacity(uint32_t bytes)
+    {
+        SpriteCacheSetCapacity(bytes);
+    }
+
+    // Removes all sprites from the sprite cache.
+    EXPORT void PurgeSpriteCache()
+    {
+        SpriteCachePurge();
+    }
+
+    struct SpriteRequest
+    {
+        uint32_t imageIndex;
+        uint8_t colour1;
+        uint8_t colour2;
+        uint8_t colour3;
+    };
+
+    // Location of a baked sprite within the atlas, with the origin in the bottom left corner.
+    struct SpriteRect
+    {
+        int32_t x;
+        int32_t y;
+        int16_t width;
+        int16_t height;
+        int16_t x_offset;
+        int16_t y_offset;
+    };
+
+    // Empty pixels between sprites in the atlas, to prevent bleeding when sampling.
+    static constexpr int32_t AtlasPadding = 1;
+
+    // Copies the sprite into its rectangle of the (top-down) atlas.
+    static void BakeSprite(const SpriteRequest& request, const SpriteRect& rect, uint8_t* atlas, int32_t atlasWidth)
+    {
+        const ImageId imageId = GetColouredImageId(request.imageIndex, request.colour1, request.colour2, request.colour3);
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(rect.width) * rect.height);
+        if (!SpriteCacheCopy(imageId, pixels.data(), pixels.size(), DecodeSprite))
+        {
+            return;
+        }
+
+        // Sprites are cached up-side-down, while the atlas is only flipped once all sprites are in.
+        for (int32_t y = 0; y < rect.height; y++)
+        {
+            const uint8_t* source = pixels.data() + static_cast<size_t>(rect.height - 1 - y) * rect.width;
+            std::memcpy(atlas + (static_cast<size_t>(rect.y + y) * atlasWidth) + rect.x, source, rect.width);
+        }
+    }
+
+    // Decodes the sprites of the atlas pages, kept alive between calls to not restart its threads.
+    static std::unique_ptr<JobPool> _atlasJobs;
+
+    // Packs and renders all requested sprites into a single atlas page, spreading the decoding over
+    // worker threads. Returns the amount of requests that fitted; the remaining ones can be baked into
+    // the next page by calling again with the rest of the requests. Returns -1 on invalid arguments.
+    EXPORT int32_t BakeSpriteAtlas(
+        const SpriteRequest* requests, int32_t count, uint8_t* atlas, int32_t atlasWidth, int32_t atlasHeight,
+        SpriteRect* rects)
+    {
+        if (atlas == nullptr || atlasWidth <= 0 || atlasHeight <= 0)
+        {
+            dll_log("Invalid sprite atlas of %ix%i.", atlasWidth, atlasHeight);
+            return -1;
+        }
+        if (count < 0 || (count > 0 && (requests == nullptr || rects == nullptr)))
+        {
+            dll_log("Invalid sprite atlas requests, count: %i.", count);
+            return -1;
+        }
+
+        std::fill_n(atlas, static_cast<size_t>(atlasWidth) * atlasHeight, 0);
+
+        // Simple shelf packing in request order, rows are filled from the top of the atlas.
+        int32_t shelfX = 0, shelfY = 0, shelfHeight = 0;
+        int32_t packed = 0;
+
+        for (; packed < count; packed++)
+        {
+            const ImageId imageId = GetColouredImageId(
+                requests[packed].imageIndex, requests[packed].colour1, requests[packed].colour2, requests[packed].colour3);
+            const G1Element* g1 = GfxGetG1Element(imageId);
+            SpriteRect& rect = rects[packed];
+
+            if (g1 == nullptr)
+            {
+                dll_log("Could not find g1 element for atlas request %i (combined: %i).", packed, imageId.ToUInt32());
+                rect = {};
+                continue;
+            }
+
+            const int32_t width = g1->width;
+            const int32_t height = g1->height;
+            if (width > atlasWidth || height > atlasHeight)
+            {
+                dll_log("Sprite %i of %ix%i does not fit in an atlas of %ix%i.", packed, width, height, atlasWidth, atlasHeight);
+                rect = {};
+                continue;
+            }
+
+            if (shelfX + width > atlasWidth)
+            {
+                shelfX = 0;
+                shelfY += shelfHeight + AtlasPadding;
+                shelfHeight = 0;
+            }
+            if (shelfY + height > atlasHeight)
+                break;
+
+            rect.x = shelfX;
+            rect.y = shelfY;
+            rect.width = static_cast<int16_t>(width);
+            rect.height = static_cast<int16_t>(height);
+            rect.x_offset = g1->x_offset;
+            rect.y_offset = g1->y_offset;
+
+            shelfX += width + AtlasPadding;
+            shelfHeight = std::max(shelfHeight, height);
+        }
+
+        // Rectangles never overlap, so each worker can write straight into the atlas.
+        {
+            constexpr int32_t batchSize = 64;
+            if (_atlasJobs == nullptr)
+            {
+                _atlasJobs = std::make_unique<JobPool>();
+            }
+            for (int32_t start = 0; start < packed; start += batchSize)
+            {
+                const int32_t end = std::min(start + batchSize, packed);
+                _atlasJobs->AddTask([=]() {
+                    for (int32_t i = start; i < end; i++)
+                    {
+                        if (rects[i].width > 0 && rects[i].height > 0)
+                        {
+                            BakeSprite(requests[i], rects[i], atlas, atlasWidth);
+                        }
+                    }
+                });
+            }
+            _atlasJobs->Join();
+        }
+
+        // Flip the atlas up-side-down, like the single sprites, and move the rectangles along.
+        for (int32_t y = 0; y < atlasHeight / 2; y++)
+        {
+            uint8_t* top = atlas + static_cast<size_t>(y) * atlasWidth;
+            uint8_t* bottom = atlas + static_cast<size_t>(atlasHeight - 1 - y) * atlasWidth;
+            std::swap_ranges(top, top + atlasWidth, bottom);
+        }
+        for (int32_t i = 0; i < packed; i++)
         {
-            memcpy(pixels + (lastRow - y) * width, dpi.bits + y * width, width);
+            if (rects[i].height > 0)
+            {
+                rects[i].y = atlasHeight - rects[i].y - rects[i].height;
+            }
         }
 
-        delete[] dpi.bits;
+        return packed;
     }
 }
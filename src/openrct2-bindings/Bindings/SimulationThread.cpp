@@ -0,0 +1,104 @@
+#include "SimulationThread.h"
+
+#include "../Entities/EntityTransforms.h"
+#include "../OpenRCT2.Bindings.h"
+#include "../Utilities/Logging.h"
+
+#include <atomic>
+#include <chrono>
+#include <openrct2/scenes/Scene.h>
+#include <thread>
+
+static std::recursive_mutex _simulationMutex;
+static std::thread _simulationThread;
+static std::atomic<bool> _simulationRunning = false;
+
+// Amount of host locks held by the current thread.
+static thread_local int32_t _hostLockDepth = 0;
+
+std::recursive_mutex& GetSimulationMutex()
+{
+    return _simulationMutex;
+}
+
+void SimulationHostLock()
+{
+    _simulationMutex.lock();
+    _hostLockDepth++;
+}
+
+void SimulationHostUnlock()
+{
+    if (_hostLockDepth == 0)
+    {
+        dll_log("SimulationHostUnlock() called without holding the lock.");
+        return;
+    }
+
+    _hostLockDepth--;
+    _simulationMutex.unlock();
+}
+
+void SimulationHostUnlockAll()
+{
+    while (_hostLockDepth > 0)
+    {
+        SimulationHostUnlock();
+    }
+}
+
+static void SimulationThreadRun()
+{
+    using Clock = std::chrono::steady_clock;
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(kGameUpdateTimeMS));
+    const auto maxBacklog = tickDuration * kGameMaxUpdates;
+
+    auto nextTick = Clock::now();
+    while (_simulationRunning.load(std::memory_order_relaxed))
+    {
+        {
+            std::lock_guard lock(_simulationMutex);
+            GetContext()->GetActiveScene()->Tick();
+            PublishEntityTransforms();
+        }
+
+        // Catch up after a slow tick, but drop the backlog if the simulation cannot keep up at all.
+        nextTick += tickDuration;
+        const auto now = Clock::now();
+        if (now - nextTick > maxBacklog)
+        {
+            nextTick = now;
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+}
+
+void SimulationThreadStart()
+{
+    if (_simulationRunning.exchange(true))
+        return;
+
+    dll_log("SimulationThreadStart()");
+    _simulationThread = std::thread(SimulationThreadRun);
+}
+
+bool SimulationThreadStop()
+{
+    if (_hostLockDepth > 0)
+    {
+        dll_log("SimulationThreadStop() refused, the simulation lock is still held.");
+        return false;
+    }
+
+    if (!_simulationRunning.exchange(false))
+        return true;
+
+    dll_log("SimulationThreadStop()");
+    _simulationThread.join();
+    return true;
+}
+
+bool SimulationThreadIsRunning()
+{
+    return _simulationRunning.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <mutex>
+
+// Guards the live game state while the simulation runs on its own thread. Exports that read
+// live game state instead of a published snapshot should hold this lock. Only entity transforms
+// are published every tick, as they are read every frame; map, chunk and per-entity queries are
+// read on demand and would otherwise copy the whole park each tick, so they wait for the lock.
+std::recursive_mutex& GetSimulationMutex();
+
+// Takes and releases the simulation lock on behalf of the host, across calls into the bindings.
+// Unlocking without a matching lock on the calling thread is ignored.
+void SimulationHostLock();
+void SimulationHostUnlock();
+
+// Releases every host lock held by the calling thread.
+void SimulationHostUnlockAll();
+
+// Starts ticking the active scene on a background thread at the fixed game update rate.
+void SimulationThreadStart();
+
+// Stops the background thread after its current tick has finished. Refuses and returns false when
+// the calling thread holds a host lock, as the simulation thread could never finish its tick.
+bool SimulationThreadStop();
+
+bool SimulationThreadIsRunning();
@@ -1,7 +1,11 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 
+#include <algorithm>
+#include <array>
 #include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/Guest.h>
 #include <openrct2/entity/Staff.h>
 #include <openrct2/ride/Vehicle.h>
@@ -10,6 +14,7 @@ extern "C"
 {
     EXPORT int GetEntityCount(EntityType type)
     {
+        std::lock_guard lock(GetSimulationMutex());
         return GetEntityListCount(type);
     }
 
@@ -22,8 +27,63 @@ extern "C"
 
     EXPORT void GetEntityCounts(EntityCounts* counts)
     {
+        std::lock_guard lock(GetSimulationMutex());
         counts->vehicles = GetEntityListCount(EntityType::Vehicle);
         counts->guests = GetEntityListCount(EntityType::Guest);
         counts->staff = GetEntityListCount(EntityType::Staff);
     }
+
+    struct EntityEvent
+    {
+        uint16_t entityId;
+        uint16_t generation;
+        EntityType type;
+        bool removed;
+    };
+
+    // Starts or stops recording spawned and removed entities, dropping any events not read yet.
+    EXPORT void SetEntityEventsEnabled(bool enabled)
+    {
+        std::lock_guard lock(GetSimulationMutex());
+        EntityLifecycleSetEnabled(enabled);
+    }
+
+    // Returns true once if events were dropped since the last call, because they were not read in time.
+    EXPORT bool TakeEntityEventsOverflow()
+    {
+        std::lock_guard lock(GetSimulationMutex());
+        return EntityLifecycleTakeOverflow();
+    }
+
+    // Moves all entities spawned or removed since the last call into the specified buffer, in the order
+    // they happened, returns the amount of events written. Events that do not fit are returned on the next call.
+    EXPORT int32_t GetEntityEvents(EntityEvent* events, int32_t length)
+    {
+        if (events == nullptr || length <= 0)
+            return 0;
+
+        std::lock_guard lock(GetSimulationMutex());
+        std::array<EntityLifecycleEvent, 256> buffer;
+
+        int32_t written = 0;
+        while (written < length)
+        {
+            const auto capacity = std::min<size_t>(buffer.size(), static_cast<size_t>(length - written));
+            const auto count = EntityLifecycleDrain(buffer.data(), capacity);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                const auto& source = buffer[i];
+                auto& target = events[written++];
+                target.entityId = source.Id.ToUnderlying();
+                target.generation = source.Generation;
+                target.type = source.Type;
+                target.removed = source.Removed;
+            }
+
+            if (count < capacity)
+                break;
+        }
+        return written;
+    }
 }
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <openrct2/entity/Peep.h>
+#include <openrct2/ride/Vehicle.h>
+
+// Entity structs shared between the per-type exports and the bulk entity exports.
+extern "C"
+{
+    struct PeepEntity
+    {
+        int32_t x;
+        int32_t y;
+        int32_t z;
+        uint8_t direction;
+        uint8_t tshirtColour;
+        uint8_t trousersColour;
+        uint8_t accessoryColour;
+        PeepAnimationGroup animationGroup;
+        PeepAnimationType animationType;
+        uint8_t animationOffset;
+        uint16_t entityId;
+        uint16_t generation;
+    };
+
+    struct VehicleEntity
+    {
+        int32_t x;
+        int32_t y;
+        int32_t z;
+        uint8_t direction;
+        uint8_t banking;
+        uint8_t pitch;
+        track_type_t trackType;
+        uint8_t trackDirection;
+        uint16_t trackProgress;
+        uint16_t entityId;
+        uint16_t generation;
+    };
+
+    void SetPeepInfo(PeepEntity* entity, const Peep* peep);
+    void SetVehicleInfo(VehicleEntity* entity, const Vehicle* vehicle);
+}
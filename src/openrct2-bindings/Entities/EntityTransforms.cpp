@@ -0,0 +1,199 @@
+#include "EntityTransforms.h"
+
+#include "../OpenRCT2.Bindings.h"
+#include "EntityInfo.h"
+
+#include <array>
+#include <atomic>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/entity/Staff.h>
+#include <vector>
+
+extern "C"
+{
+    // Read-only view on the most recently published entity transforms, as a struct of arrays.
+    // Entities are ordered as all guests, then all staff, then all vehicles. The arrays stay valid
+    // until the next call to GetEntityTransforms, even while the simulation keeps publishing.
+    struct EntityTransforms
+    {
+        uint32_t frame;
+        int32_t guestCount;
+        int32_t staffCount;
+        int32_t vehicleCount;
+
+        const int32_t* x;
+        const int32_t* y;
+        const int32_t* z;
+        const uint8_t* direction;
+        const uint8_t* pitch;
+        const uint8_t* banking;
+        const uint8_t* animationGroup;
+        const uint8_t* animationType;
+        const uint8_t* animationOffset;
+        const uint8_t* colour1;
+        const uint8_t* colour2;
+        const uint8_t* colour3;
+        const uint16_t* entityId;
+        const uint16_t* generation;
+    };
+}
+
+// Engine-owned storage for one frame of entity transforms. Columns only ever grow, so the
+// pointers handed to the host only change when the amount of entities exceeds the old peak.
+struct EntityTransformBuffer
+{
+    uint32_t frame;
+    int32_t guestCount;
+    int32_t staffCount;
+    int32_t vehicleCount;
+
+    std::vector<int32_t> x;
+    std::vector<int32_t> y;
+    std::vector<int32_t> z;
+    std::vector<uint8_t> direction;
+    std::vector<uint8_t> pitch;
+    std::vector<uint8_t> banking;
+    std::vector<uint8_t> animationGroup;
+    std::vector<uint8_t> animationType;
+    std::vector<uint8_t> animationOffset;
+    std::vector<uint8_t> colour1;
+    std::vector<uint8_t> colour2;
+    std::vector<uint8_t> colour3;
+    std::vector<uint16_t> entityId;
+    std::vector<uint16_t> generation;
+
+    void Reserve(size_t count)
+    {
+        if (x.size() >= count)
+            return;
+
+        x.resize(count);
+        y.resize(count);
+        z.resize(count);
+        direction.resize(count);
+        pitch.resize(count);
+        banking.resize(count);
+        animationGroup.resize(count);
+        animationType.resize(count);
+        animationOffset.resize(count);
+        colour1.resize(count);
+        colour2.resize(count);
+        colour3.resize(count);
+        entityId.resize(count);
+        generation.resize(count);
+    }
+};
+
+// Triple buffer: the publisher owns the back buffer, the host owns the front buffer and the
+// middle slot holds the latest completed frame. Both sides only ever swap their own buffer with
+// the middle one, so neither side has to wait on the other.
+static std::array<EntityTransformBuffer, 3> _transformBuffers;
+static constexpr uint8_t kTransformIndexMask = 0b011;
+static constexpr uint8_t kTransformFreshFlag = 0b100;
+
+static uint8_t _transformBack = 0;
+static std::atomic<uint8_t> _transformMiddle = 1;
+static uint8_t _transformFront = 2;
+static uint32_t _transformFrame = 0;
+
+static void WritePeepTransform(EntityTransformBuffer& buffer, size_t index, const Peep* peep)
+{
+    PeepEntity info{};
+    SetPeepInfo(&info, peep);
+
+    buffer.x[index] = info.x;
+    buffer.y[index] = info.y;
+    buffer.z[index] = info.z;
+    buffer.direction[index] = info.direction;
+    buffer.pitch[index] = 0;
+    buffer.banking[index] = 0;
+    buffer.animationGroup[index] = static_cast<uint8_t>(info.animationGroup);
+    buffer.animationType[index] = static_cast<uint8_t>(info.animationType);
+    buffer.animationOffset[index] = info.animationOffset;
+    buffer.colour1[index] = info.tshirtColour;
+    buffer.colour2[index] = info.trousersColour;
+    buffer.colour3[index] = info.accessoryColour;
+    buffer.entityId[index] = info.entityId;
+    buffer.generation[index] = info.generation;
+}
+
+static void WriteVehicleTransform(EntityTransformBuffer& buffer, size_t index, const Vehicle* vehicle)
+{
+    buffer.x[index] = vehicle->x;
+    buffer.y[index] = vehicle->y;
+    buffer.z[index] = vehicle->z;
+    buffer.direction[index] = vehicle->Orientation;
+    buffer.pitch[index] = vehicle->Pitch;
+    buffer.banking[index] = vehicle->bank_rotation;
+    buffer.animationGroup[index] = 0;
+    buffer.animationType[index] = 0;
+    buffer.animationOffset[index] = vehicle->animation_frame;
+    buffer.colour1[index] = vehicle->colours.Body;
+    buffer.colour2[index] = vehicle->colours.Trim;
+    buffer.colour3[index] = vehicle->colours.Tertiary;
+    buffer.entityId[index] = vehicle->Id.ToUnderlying();
+    buffer.generation[index] = GetEntityGeneration(vehicle->Id);
+}
+
+void PublishEntityTransforms()
+{
+    EntityTransformBuffer& buffer = _transformBuffers[_transformBack];
+
+    buffer.frame = ++_transformFrame;
+    buffer.guestCount = GetEntityListCount(EntityType::Guest);
+    buffer.staffCount = GetEntityListCount(EntityType::Staff);
+    buffer.vehicleCount = GetEntityListCount(EntityType::Vehicle);
+    buffer.Reserve(buffer.guestCount + buffer.staffCount + buffer.vehicleCount);
+
+    size_t index = 0;
+    for (const Guest* guest : EntityList<Guest>())
+    {
+        WritePeepTransform(buffer, index++, guest);
+    }
+    for (const Staff* staff : EntityList<Staff>())
+    {
+        WritePeepTransform(buffer, index++, staff);
+    }
+    for (const Vehicle* vehicle : EntityList<Vehicle>())
+    {
+        WriteVehicleTransform(buffer, index++, vehicle);
+    }
+
+    const uint8_t previous = _transformMiddle.exchange(_transformBack | kTransformFreshFlag, std::memory_order_acq_rel);
+    _transformBack = previous & kTransformIndexMask;
+}
+
+extern "C"
+{
+    // Gets pointers to the most recently published entity transforms, without copying them.
+    EXPORT void GetEntityTransforms(EntityTransforms* transforms)
+    {
+        if (_transformMiddle.load(std::memory_order_relaxed) & kTransformFreshFlag)
+        {
+            const uint8_t latest = _transformMiddle.exchange(_transformFront, std::memory_order_acq_rel);
+            _transformFront = latest & kTransformIndexMask;
+        }
+        const EntityTransformBuffer& buffer = _transformBuffers[_transformFront];
+
+        transforms->frame = buffer.frame;
+        transforms->guestCount = buffer.guestCount;
+        transforms->staffCount = buffer.staffCount;
+        transforms->vehicleCount = buffer.vehicleCount;
+        transforms->x = buffer.x.data();
+        transforms->y = buffer.y.data();
+        transforms->z = buffer.z.data();
+        transforms->direction = buffer.direction.data();
+        transforms->pitch = buffer.pitch.data();
+        transforms->banking = buffer.banking.data();
+        transforms->animationGroup = buffer.animationGroup.data();
+        transforms->animationType = buffer.animationType.data();
+        transforms->animationOffset = buffer.animationOffset.data();
+        transforms->colour1 = buffer.colour1.data();
+        transforms->colour2 = buffer.colour2.data();
+        transforms->colour3 = buffer.colour3.data();
+        transforms->entityId = buffer.entityId.data();
+        transforms->generation = buffer.generation.data();
+    }
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Copies the transforms of all guests, staff and vehicles into the back buffer and swaps it to the front.
+void PublishEntityTransforms();
@@ -1,7 +1,10 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
+#include "EntityInfo.h"
 
 #include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/Guest.h>
 #include <openrct2/entity/Peep.h>
 #include <openrct2/entity/Staff.h>
@@ -10,23 +13,7 @@
 
 extern "C"
 {
-    EXPORT 
-
-    struct PeepEntity
-    {
-        int32_t x;
-        int32_t y;
-        int32_t z;
-        uint8_t direction;
-        uint8_t tshirtColour;
-        uint8_t trousersColour;
-        uint8_t accessoryColour;
-        PeepAnimationGroup animationGroup;
-        PeepAnimationType animationType;
-        uint8_t animationOffset;
-    };
-
-    static void SetPeepInfo(PeepEntity* entity, const Peep* peep)
+    void SetPeepInfo(PeepEntity* entity, const Peep* peep)
     {
         entity->x = peep->x;
         entity->y = peep->y;
@@ -34,6 +21,8 @@ extern "C"
         entity->direction = peep->PeepDirection;
         entity->tshirtColour = peep->TshirtColour;
         entity->trousersColour = peep->TrousersColour;
+        entity->entityId = peep->Id.ToUnderlying();
+        entity->generation = GetEntityGeneration(peep->Id);
 
         const auto group = peep->AnimationGroup;
         entity->animationGroup = group;
@@ -74,6 +63,7 @@ extern "C"
     // Loads all the guests into the specified buffer, returns the total amount of guests loaded.
     EXPORT int32_t GetAllGuests(PeepEntity* peeps, int32_t length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         int32_t peepCount = 0;
 
         for (const Guest* guest : EntityList<Guest>())
@@ -91,6 +81,7 @@ extern "C"
     // Loads all the staff into the specified buffer, returns the total amount of staff loaded.
     EXPORT int32_t GetAllStaff(PeepEntity* peeps, int32_t length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         int32_t peepCount = 0;
 
         for (const Staff* staff : EntityList<Staff>())
@@ -150,6 +141,7 @@ extern "C"
     // or false depending on whether the peep existed or not.
     EXPORT bool GetGuestStats(uint16_t spriteIndex, GuestStats* stats)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const Guest* guest = TryGetEntity<Guest>(EntityId::FromUnderlying(spriteIndex));
 
         if (guest == nullptr)
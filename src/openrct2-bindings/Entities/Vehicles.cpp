@@ -1,44 +1,40 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
+#include "EntityInfo.h"
 
 #include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/ride/Vehicle.h>
 
 extern "C"
 {
-    struct VehicleEntity
+    void SetVehicleInfo(VehicleEntity* target, const Vehicle* vehicle)
     {
-        int32_t x;
-        int32_t y;
-        int32_t z;
-        uint8_t direction;
-        uint8_t banking;
-        uint8_t pitch;
-        track_type_t trackType;
-        uint8_t trackDirection;
-        uint16_t trackProgress;
-    };
+        target->x = vehicle->x;
+        target->y = vehicle->y;
+        target->z = vehicle->z;
+
+        target->direction = vehicle->Orientation;
+        target->banking = vehicle->bank_rotation;
+        target->pitch = vehicle->Pitch;
+
+        target->trackType = vehicle->GetTrackType();
+        target->trackDirection = vehicle->GetTrackDirection();
+        target->trackProgress = vehicle->track_progress;
+
+        target->entityId = vehicle->Id.ToUnderlying();
+        target->generation = GetEntityGeneration(vehicle->Id);
+    }
 
     // Loads all the vehicles into the specified buffer, returns the total amount of vehicles loaded.
     EXPORT int32_t GetAllVehicles(VehicleEntity* vehicles, int32_t length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         int vehicleCount = 0;
 
         for (const Vehicle* vehicle : EntityList<Vehicle>())
         {
-            VehicleEntity* target = &vehicles[vehicleCount];
-
-            target->x = vehicle->x;
-            target->y = vehicle->y;
-            target->z = vehicle->z;
-
-            target->direction = vehicle->Orientation;
-            target->banking = vehicle->bank_rotation;
-            target->pitch = vehicle->Pitch;
-
-            target->trackType = vehicle->GetTrackType();
-            target->trackDirection = vehicle->GetTrackDirection();
-            target->trackProgress = vehicle->track_progress;
-
+            SetVehicleInfo(&vehicles[vehicleCount], vehicle);
             vehicleCount++;
 
             if (vehicleCount >= length)
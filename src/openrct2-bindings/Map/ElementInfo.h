@@ -0,0 +1,83 @@
+#pragma once
+
+#include <openrct2/world/TileElement.h>
+
+// Element structs shared between the per-tile exports and the bulk map exports.
+extern "C"
+{
+    const uint8_t IdentifierSize = 50;
+
+    struct TileElementInfo
+    {
+        TileElementType type;
+        uint8_t rotation;
+        uint8_t baseHeight;
+        bool invisible;
+    };
+
+    struct SurfaceInfo
+    {
+        uint32_t surfaceImageIndex;
+        uint32_t edgeImageIndex;
+        int32_t waterHeight;
+        uint8_t slope;
+    };
+
+    struct PathInfo
+    {
+        uint32_t surfaceIndex;
+        uint32_t railingIndex;
+        bool sloped;
+        uint8_t slopeDirection;
+        uint8_t edges;
+    };
+
+    struct TrackInfo
+    {
+        uint16_t trackType;
+        int8_t trackHeight;
+        uint8_t sequenceIndex;
+        uint8_t mainColour;
+        uint8_t additionalColour;
+        uint8_t supportsColour;
+        bool chainlift;
+        bool cablelift;
+        bool inverted;
+        bool normalToInverted;
+        bool invertedToNormal;
+    };
+
+    struct SmallSceneryInfo
+    {
+        uint32_t imageIndex;
+        ObjectEntryIndex objectIndex;
+        uint8_t quadrant;
+        bool fullTile;
+        uint8_t colour1;
+        uint8_t colour2;
+        uint8_t colour3;
+        bool animated;
+        uint16_t animationFrameCount;
+        uint16_t animationFrameDelay;
+        char identifier[IdentifierSize];
+    };
+
+    struct WallInfo
+    {
+        uint32_t imageIndex;
+        uint8_t slope;
+        uint8_t colour1;
+        uint8_t colour2;
+        uint8_t colour3;
+        uint16_t animationFrameCount;
+        uint16_t animationFrameDelay;
+        bool animated;
+    };
+
+    void SetTileElementInfo(TileElementInfo* info, const TileElement* element);
+    void SetSurfaceInfo(int x, int y, int index, const TileElement* source, SurfaceInfo* target);
+    void SetPathInfo(int x, int y, int index, const TileElement* source, PathInfo* target);
+    void SetTrackInfo(int x, int y, int index, const TileElement* source, TrackInfo* target);
+    void SetSmallSceneryInfo(int x, int y, int index, const TileElement* source, SmallSceneryInfo* target);
+    void SetWallInfo(int x, int y, int index, const TileElement* source, WallInfo* target);
+}
@@ -1,7 +1,9 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 
 #include <openrct2/GameState.h>
+#include <openrct2/world/MapChanges.h>
 
 extern "C"
 {
@@ -14,9 +16,23 @@ extern "C"
     // Gets the amount of tiles on both edges of the map.
     EXPORT void GetMapSize(MapSize* size)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const auto& mapSize = GetGameState().MapSize;
         dll_log("GetMapSize(%d, %d)", mapSize.x, mapSize.y);
         size->width = mapSize.x;
         size->height = mapSize.y;
     }
+
+    // Moves the coordinates of all tiles that changed since the last call into the specified buffer,
+    // returns the amount of tiles written. Tiles that do not fit are returned on the next call.
+    EXPORT int32_t GetChangedTiles(TileCoordsXY* tiles, int32_t length)
+    {
+        static_assert(sizeof(TileCoordsXY) == sizeof(int32_t) * 2, "Size is not correct");
+
+        if (tiles == nullptr || length <= 0)
+            return 0;
+
+        std::lock_guard lock(GetSimulationMutex());
+        return static_cast<int32_t>(MapChangesDrain(tiles, static_cast<size_t>(length)));
+    }
 }
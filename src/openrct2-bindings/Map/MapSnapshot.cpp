@@ -0,0 +1,286 @@
+#include "../Bindings/SimulationThread.h"
+#include "../OpenRCT2.Bindings.h"
+#include "../Utilities/Logging.h"
+#include "ElementInfo.h"
+
+#include <algorithm>
+#include <openrct2/GameState.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/MapChanges.h>
+
+extern "C"
+{
+    // Layout version of the snapshot buffers, bump whenever one of the element structs changes.
+    const uint32_t MapSnapshotVersion = 2;
+
+    // Amount of records required to hold a snapshot of a rectangle of tiles.
+    struct MapSnapshotCounts
+    {
+        uint32_t version;
+        int32_t tiles;
+        int32_t elements;
+        int32_t surfaces;
+        int32_t paths;
+        int32_t tracks;
+        int32_t smallScenery;
+        int32_t walls;
+    };
+
+    // Caller-provided struct-of-arrays buffers. Every offsets array holds one entry per tile
+    // plus one, so the records of tile 'i' are found at [offsets[i], offsets[i + 1]).
+    // Tiles are ordered x-major: tile index = (x - startX) * height + (y - startY).
+    struct MapSnapshot
+    {
+        uint32_t version;
+        int32_t capacityOffsets;
+        int32_t capacityElements;
+        int32_t capacitySurfaces;
+        int32_t capacityPaths;
+        int32_t capacityTracks;
+        int32_t capacitySmallScenery;
+        int32_t capacityWalls;
+
+        int32_t* elementOffsets;
+        TileElementInfo* elements;
+        int32_t* surfaceOffsets;
+        SurfaceInfo* surfaces;
+        int32_t* pathOffsets;
+        PathInfo* paths;
+        int32_t* trackOffsets;
+        TrackInfo* tracks;
+        int32_t* smallSceneryOffsets;
+        SmallSceneryInfo* smallScenery;
+        int32_t* wallOffsets;
+        WallInfo* walls;
+    };
+
+    // Rectangle of tiles covered by a chunk, clipped to the map, and the version it is at.
+    struct MapChunkInfo
+    {
+        int32_t x;
+        int32_t y;
+        int32_t width;
+        int32_t height;
+        uint32_t version;
+    };
+
+    // Returns whether the rectangle of tiles lies within the map, empty rectangles are allowed.
+    static bool IsValidSnapshotRect(int startX, int startY, int width, int height)
+    {
+        const auto& mapSize = GetGameState().MapSize;
+        return startX >= 0 && startY >= 0 && width >= 0 && height >= 0 && width <= mapSize.x - startX
+            && height <= mapSize.y - startY;
+    }
+
+    // Counts all tile elements per supported type within the specified rectangle of tiles.
+    static void CountMapSnapshot(int startX, int startY, int width, int height, MapSnapshotCounts* counts)
+    {
+        *counts = {};
+        counts->version = MapSnapshotVersion;
+
+        if (!IsValidSnapshotRect(startX, startY, width, height))
+        {
+            dll_log("Map snapshot rectangle %ix%i at %i, %i is outside the map.", width, height, startX, startY);
+            return;
+        }
+        counts->tiles = width * height;
+
+        for (int x = startX; x < startX + width; x++)
+        {
+            for (int y = startY; y < startY + height; y++)
+            {
+                const TileElement* element = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                if (element == nullptr)
+                    continue;
+
+                do
+                {
+                    counts->elements++;
+
+                    switch (element->GetType())
+                    {
+                        case TileElementType::Surface:
+                            counts->surfaces++;
+                            break;
+                        case TileElementType::Path:
+                            counts->paths++;
+                            break;
+                        case TileElementType::Track:
+                            counts->tracks++;
+                            break;
+                        case TileElementType::SmallScenery:
+                            counts->smallScenery++;
+                            break;
+                        case TileElementType::Wall:
+                            counts->walls++;
+                            break;
+                        default:
+                            break;
+                    }
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+    }
+
+    // Writes all tile elements within the specified rectangle of tiles into the snapshot buffers
+    // in a single pass. Returns the amount of tile elements written, or -1 if the buffers do not
+    // match the current layout version or are too small, or if the rectangle is outside the map.
+    static int32_t WriteMapSnapshot(int startX, int startY, int width, int height, MapSnapshot* snapshot)
+    {
+        if (snapshot->version != MapSnapshotVersion)
+        {
+            dll_log("Map snapshot version mismatch, expected %u but got %u.", MapSnapshotVersion, snapshot->version);
+            return -1;
+        }
+        if (!IsValidSnapshotRect(startX, startY, width, height))
+        {
+            dll_log("Map snapshot rectangle %ix%i at %i, %i is outside the map.", width, height, startX, startY);
+            return -1;
+        }
+        if (snapshot->capacityOffsets <= width * height)
+        {
+            dll_log("Map snapshot offset buffers too small for %ix%i tiles.", width, height);
+            return -1;
+        }
+
+        int32_t elements = 0, surfaces = 0, paths = 0, tracks = 0, smallScenery = 0, walls = 0;
+        int32_t tile = 0;
+
+        for (int x = startX; x < startX + width; x++)
+        {
+            for (int y = startY; y < startY + height; y++)
+            {
+                snapshot->elementOffsets[tile] = elements;
+                snapshot->surfaceOffsets[tile] = surfaces;
+                snapshot->pathOffsets[tile] = paths;
+                snapshot->trackOffsets[tile] = tracks;
+                snapshot->smallSceneryOffsets[tile] = smallScenery;
+                snapshot->wallOffsets[tile] = walls;
+                tile++;
+
+                const TileElement* element = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                if (element == nullptr)
+                    continue;
+
+                int index = 0;
+                do
+                {
+                    if (elements >= snapshot->capacityElements)
+                    {
+                        dll_log("Map snapshot element buffer too small at %i, %i.", x, y);
+                        return -1;
+                    }
+                    SetTileElementInfo(&snapshot->elements[elements++], element);
+
+                    switch (element->GetType())
+                    {
+                        case TileElementType::Surface:
+                            if (surfaces >= snapshot->capacitySurfaces)
+                            {
+                                dll_log("Map snapshot surface buffer too small at %i, %i.", x, y);
+                                return -1;
+                            }
+                            SetSurfaceInfo(x, y, index, element, &snapshot->surfaces[surfaces++]);
+                            break;
+                        case TileElementType::Path:
+                            if (paths >= snapshot->capacityPaths)
+                            {
+                                dll_log("Map snapshot path buffer too small at %i, %i.", x, y);
+                                return -1;
+                            }
+                            SetPathInfo(x, y, index, element, &snapshot->paths[paths++]);
+                            break;
+                        case TileElementType::Track:
+                            if (tracks >= snapshot->capacityTracks)
+                            {
+                                dll_log("Map snapshot track buffer too small at %i, %i.", x, y);
+                                return -1;
+                            }
+                            SetTrackInfo(x, y, index, element, &snapshot->tracks[tracks++]);
+                            break;
+                        case TileElementType::SmallScenery:
+                            if (smallScenery >= snapshot->capacitySmallScenery)
+                            {
+                                dll_log("Map snapshot small scenery buffer too small at %i, %i.", x, y);
+                                return -1;
+                            }
+                            SetSmallSceneryInfo(x, y, index, element, &snapshot->smallScenery[smallScenery++]);
+                            break;
+                        case TileElementType::Wall:
+                            if (walls >= snapshot->capacityWalls)
+                            {
+                                dll_log("Map snapshot wall buffer too small at %i, %i.", x, y);
+                                return -1;
+                            }
+                            SetWallInfo(x, y, index, element, &snapshot->walls[walls++]);
+                            break;
+                        default:
+                            break;
+                    }
+                    index++;
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+
+        snapshot->elementOffsets[tile] = elements;
+        snapshot->surfaceOffsets[tile] = surfaces;
+        snapshot->pathOffsets[tile] = paths;
+        snapshot->trackOffsets[tile] = tracks;
+        snapshot->smallSceneryOffsets[tile] = smallScenery;
+        snapshot->wallOffsets[tile] = walls;
+        return elements;
+    }
+
+    // Gets the buffer sizes required for a snapshot of the specified rectangle of tiles.
+    EXPORT void GetMapSnapshotCounts(int x, int y, int width, int height, MapSnapshotCounts* counts)
+    {
+        std::lock_guard lock(GetSimulationMutex());
+        CountMapSnapshot(x, y, width, height, counts);
+    }
+
+    // Writes all tile elements of the specified rectangle of tiles into the caller-provided buffers,
+    // returns the amount of tile elements written or -1 on failure.
+    EXPORT int32_t GetMapSnapshot(int x, int y, int width, int height, MapSnapshot* snapshot)
+    {
+        std::lock_guard lock(GetSimulationMutex());
+        return WriteMapSnapshot(x, y, width, height, snapshot);
+    }
+
+    // Gets the tiles covered by the specified chunk and its current version. Read the version
+    // before the chunk's tiles, so a change in between is picked up on the next comparison.
+    EXPORT void GetMapChunkInfo(int chunkX, int chunkY, MapChunkInfo* chunk)
+    {
+        std::lock_guard lock(GetSimulationMutex());
+
+        const auto& mapSize = GetGameState().MapSize;
+        const int x = chunkX * kMapChangesChunkSize;
+        const int y = chunkY * kMapChangesChunkSize;
+
+        chunk->x = x;
+        chunk->y = y;
+        chunk->width = std::clamp(mapSize.x - x, 0, kMapChangesChunkSize);
+        chunk->height = std::clamp(mapSize.y - y, 0, kMapChangesChunkSize);
+        chunk->version = MapChangesGetChunkVersion({ chunkX, chunkY });
+    }
+
+    // Writes the versions of all chunks on the map into the specified buffer, ordered x-major,
+    // returns the amount of chunks on the map.
+    EXPORT int32_t GetMapChunkVersions(uint32_t* versions, int32_t length)
+    {
+        std::lock_guard lock(GetSimulationMutex());
+
+        const auto& mapSize = GetGameState().MapSize;
+        const int chunksX = (mapSize.x + kMapChangesChunkSize - 1) / kMapChangesChunkSize;
+        const int chunksY = (mapSize.y + kMapChangesChunkSize - 1) / kMapChangesChunkSize;
+
+        int32_t index = 0;
+        for (int x = 0; x < chunksX; x++)
+        {
+            for (int y = 0; y < chunksY && index < length; y++)
+            {
+                versions[index++] = MapChangesGetChunkVersion({ x, y });
+            }
+        }
+        return chunksX * chunksY;
+    }
+}
@@ -1,6 +1,8 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 #include "../Utilities/TileElementHelper.h"
+#include "ElementInfo.h"
 
 #include <openrct2/object/FootpathSurfaceObject.h>
 #include <openrct2/world/Map.h>
@@ -19,15 +21,6 @@ extern "C"
         0, 1, 2, 3, 4, 5, 6,  7,  8, 9,  10, 11, 12, 13, 14, 49, 0, 1, 2, 3,  4, 5, 6, 7,  8, 9, 10, 11, 12, 13, 14, 50
     };
 
-    struct PathInfo
-    {
-        uint32_t surfaceIndex;
-        uint32_t railingIndex;
-        bool sloped;
-        uint8_t slopeDirection;
-        uint8_t edges;
-    };
-
     // Returns the sprite image index for a small scenery tile element.
     //  Inspired by: path_paint()
     uint32_t GetPathSurfaceImageIndex(const PathElement* path)
@@ -55,7 +48,7 @@ extern "C"
         return 0;
     }
 
-    static void SetPathInfo(int x, int y, int index, const TileElement* source, PathInfo* target)
+    void SetPathInfo(int x, int y, int index, const TileElement* source, PathInfo* target)
     {
         const PathElement* path = source->AsPath();
 
@@ -74,6 +67,7 @@ extern "C"
     // Writes the path element details to the specified buffer.
     EXPORT void GetPathElementAt(int x, int y, int index, PathInfo* element)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index, TileElementType::Path);
         SetPathInfo(x, y, index, source, element);
     }
@@ -81,6 +75,7 @@ extern "C"
     // Writes all the path element details to the specified buffer.
     EXPORT int GetAllPathElementsAt(int x, int y, PathInfo* elements, int length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = MapGetFirstElementAt(TileCoordsXY{ x, y });
         auto index = 0;
 
@@ -1,6 +1,8 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 #include "../Utilities/TileElementHelper.h"
+#include "ElementInfo.h"
 
 #include <iostream>
 #include <openrct2/object/ObjectManager.h>
@@ -11,23 +13,6 @@
 
 extern "C"
 {
-    const uint8_t IdentifierSize = 50;
-
-    struct SmallSceneryInfo
-    {
-        uint32_t imageIndex;
-        ObjectEntryIndex objectIndex;
-        uint8_t quadrant;
-        bool fullTile;
-        uint8_t colour1;
-        uint8_t colour2;
-        uint8_t colour3;
-        bool animated;
-        uint16_t animationFrameCount;
-        uint16_t animationFrameDelay;
-        char identifier[IdentifierSize];
-    };
-
     // Adjusts the image index if the scenery element has colours or withering.
     uint32_t GetIndexWithWither(const SmallSceneryElement* element, const SmallSceneryEntry* entry)
     {
@@ -51,7 +36,7 @@ extern "C"
         return imageIndex;
     }
 
-    static void SetSmallSceneryInfo(int x, int y, int index, const TileElement* source, SmallSceneryInfo* target)
+    void SetSmallSceneryInfo(int x, int y, int index, const TileElement* source, SmallSceneryInfo* target)
     {
         const SmallSceneryElement* scenery = source->AsSmallScenery();
 
@@ -90,6 +75,7 @@ extern "C"
     // Writes the small scenery element details to the specified buffer.
     EXPORT void GetSmallSceneryElementAt(int x, int y, int index, SmallSceneryInfo* element)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index, TileElementType::SmallScenery);
         SetSmallSceneryInfo(x, y, index, source, element);
     }
@@ -97,6 +83,7 @@ extern "C"
     // Writes all the small scenery element details to the specified buffer.
     EXPORT int GetAllSmallSceneryElementsAt(int x, int y, SmallSceneryInfo* elements, int length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = MapGetFirstElementAt(TileCoordsXY{ x, y });
         auto index = 0;
 
@@ -121,6 +108,7 @@ extern "C"
     // Get all indices of the animation of this small scenery element, returns the amount of animation frames.
     EXPORT int32_t GetSmallSceneryAnimationIndices(int x, int y, int index, uint32_t* indices, int32_t length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index, TileElementType::SmallScenery);
         const SmallSceneryElement* sceneryElement = source->AsSmallScenery();
         const SmallSceneryEntry* entry = sceneryElement->GetEntry();
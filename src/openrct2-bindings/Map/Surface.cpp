@@ -1,7 +1,10 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 #include "../Utilities/TileElementHelper.h"
+#include "ElementInfo.h"
 
+#include <algorithm>
 #include <openrct2/object/TerrainEdgeObject.h>
 #include <openrct2/object/TerrainSurfaceObject.h>
 #include <openrct2/paint/tile_element/Paint.Surface.h>
@@ -9,12 +12,17 @@
 
 extern "C"
 {
-    struct SurfaceInfo
+    // Caller-provided arrays that receive the surface of every tile in a rectangle, ordered
+    // x-major: tile index = (x - startX) * height + (y - startY). Heights are in base height units.
+    struct SurfaceHeightfield
     {
-        uint32_t surfaceImageIndex;
-        uint32_t edgeImageIndex;
-        int32_t waterHeight;
-        uint8_t slope;
+        int32_t capacity;
+
+        uint16_t* cornerHeights; // Four per tile, in direction order.
+        uint16_t* waterHeights;
+        ObjectEntryIndex* surfaceObjects;
+        ObjectEntryIndex* edgeObjects;
+        uint8_t* ownership;
     };
 
     // Returns the sprite image index for a surface sprite.
@@ -49,7 +57,7 @@ extern "C"
         return edgeObject->BaseImageId + 5; // EDGE_BOTTOMRIGHT = +5
     }
 
-    static void SetSurfaceInfo(int x, int y, int index, const TileElement* source, SurfaceInfo* target)
+    void SetSurfaceInfo(int x, int y, int index, const TileElement* source, SurfaceInfo* target)
     {
         const SurfaceElement* surface = source->AsSurface();
 
@@ -68,6 +76,7 @@ extern "C"
     // Writes the surface element details to the specified buffer.
     EXPORT void GetSurfaceElementAt(int x, int y, int index, SurfaceInfo* element)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index, TileElementType::Surface);
         SetSurfaceInfo(x, y, index, source, element);
     }
@@ -75,6 +84,7 @@ extern "C"
     // Writes all the surface element details to the specified buffer.
     EXPORT int GetAllSurfaceElementsAt(int x, int y, SurfaceInfo* elements, int length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = MapGetFirstElementAt(TileCoordsXY{ x, y });
         auto index = 0;
 
@@ -96,6 +106,49 @@ extern "C"
         return index;
     }
 
+    // Writes the surface of every tile within the specified rectangle into the heightfield arrays
+    // in a single pass, returns the amount of tiles written or -1 if the arrays are too small.
+    // Tiles without a surface are written as zero height and OBJECT_ENTRY_INDEX_NULL objects.
+    EXPORT int32_t GetSurfaceHeightfield(int startX, int startY, int width, int height, SurfaceHeightfield* field)
+    {
+        if (width * height > field->capacity)
+        {
+            dll_log("Surface heightfield of %ix%i tiles does not fit in %i tiles.", width, height, field->capacity);
+            return -1;
+        }
+
+        std::lock_guard lock(GetSimulationMutex());
+
+        int32_t tile = 0;
+        for (int x = startX; x < startX + width; x++)
+        {
+            for (int y = startY; y < startY + height; y++, tile++)
+            {
+                uint16_t* corners = &field->cornerHeights[tile * 4];
+                const SurfaceElement* surface = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
+                if (surface == nullptr)
+                {
+                    std::fill_n(corners, 4, 0);
+                    field->waterHeights[tile] = 0;
+                    field->surfaceObjects[tile] = OBJECT_ENTRY_INDEX_NULL;
+                    field->edgeObjects[tile] = OBJECT_ENTRY_INDEX_NULL;
+                    field->ownership[tile] = 0;
+                    continue;
+                }
+
+                for (int32_t direction = 0; direction < 4; direction++)
+                {
+                    corners[direction] = static_cast<uint16_t>(TileElementGetCornerHeight(surface, direction));
+                }
+                field->waterHeights[tile] = static_cast<uint16_t>(surface->GetWaterHeight() / kCoordsZStep);
+                field->surfaceObjects[tile] = surface->GetSurfaceObjectIndex();
+                field->edgeObjects[tile] = surface->GetEdgeObjectIndex();
+                field->ownership[tile] = surface->GetOwnership();
+            }
+        }
+        return tile;
+    }
+
     // Returns the sprite image for a regular water tile.
     //  Inspired by: PaintSurface()
     EXPORT uint32_t GetWaterImageIndex()
@@ -1,3 +1,4 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 
@@ -20,6 +21,7 @@ extern "C"
 
     EXPORT void GetElementCounts(int x, int y, TileCounts* counts)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* element = MapGetFirstElementAt(TileCoordsXY{ x, y });
 
         do
@@ -1,19 +1,13 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 #include "../Utilities/TileElementHelper.h"
+#include "ElementInfo.h"
 
 #include <openrct2/world/Park.h>
 
 extern "C"
 {
-    struct TileElementInfo
-    {
-        TileElementType type;
-        uint8_t rotation;
-        uint8_t baseHeight;
-        bool invisible;
-    };
-
     void SetTileElementInfo(TileElementInfo* info, const TileElement* element)
     {
         info->type = element->GetType();
@@ -25,6 +19,7 @@ extern "C"
     // Gets the specified tile-element at the the specified coordinates.
     EXPORT void GetMapElementAt(int x, int y, int index, TileElementInfo* element)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index);
         SetTileElementInfo(element, source);
     }
@@ -32,6 +27,7 @@ extern "C"
     // Writes all tile-elements at the the specified coordinates to the specified buffer.
     EXPORT int GetMapElementsAt(int x, int y, TileElementInfo* elements, int length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, 0);
         int elementCount = 0;
 
@@ -1,6 +1,8 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 #include "../Utilities/TileElementHelper.h"
+#include "ElementInfo.h"
 
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
@@ -10,22 +12,7 @@ using namespace OpenRCT2::TrackMetaData;
 
 extern "C"
 {
-    struct TrackInfo
-    {
-        uint16_t trackType;
-        int8_t trackHeight;
-        uint8_t sequenceIndex;
-        uint8_t mainColour;
-        uint8_t additionalColour;
-        uint8_t supportsColour;
-        bool chainlift;
-        bool cablelift;
-        bool inverted;
-        bool normalToInverted;
-        bool invertedToNormal;
-    };
-
-    static void SetTrackInfo(int x, int y, int index, const TileElement* source, TrackInfo* target)
+    void SetTrackInfo(int x, int y, int index, const TileElement* source, TrackInfo* target)
     {
         const TrackElement* track = source->AsTrack();
 
@@ -59,6 +46,7 @@ extern "C"
     // Writes the track element details to the specified buffer.
     EXPORT void GetTrackElementAt(int x, int y, int index, TrackInfo* element)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index, TileElementType::Track);
         SetTrackInfo(x, y, index, source, element);
     }
@@ -66,6 +54,7 @@ extern "C"
     // Writes all the track element details to the specified buffer.
     EXPORT int GetAllTrackElementsAt(int x, int y, TrackInfo* elements, int length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = MapGetFirstElementAt(TileCoordsXY{ x, y });
         auto index = 0;
 
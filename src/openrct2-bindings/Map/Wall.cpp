@@ -1,24 +1,14 @@
+#include "../Bindings/SimulationThread.h"
 #include "../OpenRCT2.Bindings.h"
 #include "../Utilities/Logging.h"
 #include "../Utilities/TileElementHelper.h"
+#include "ElementInfo.h"
 
 #include <openrct2/object/WallSceneryEntry.h>
 #include <openrct2/world/Map.h>
 
 extern "C"
 {
-    struct WallInfo
-    {
-        uint32_t imageIndex;
-        uint8_t slope;
-        uint8_t colour1;
-        uint8_t colour2;
-        uint8_t colour3;
-        uint16_t animationFrameCount;
-        uint16_t animationFrameDelay;
-        bool animated;
-    };
-
     // Returns the sprite image index for a small scenery tile element.
     //  Inspired by: PaintWall(), PaintWallWall()
     uint32_t GetWallImageIndex(const WallElement* element, const WallSceneryEntry* entry)
@@ -58,7 +48,7 @@ extern "C"
         return entry->image + imageOffset;
     }
 
-    static void SetWallInfo(int x, int y, int index, const TileElement* source, WallInfo* target)
+    void SetWallInfo(int x, int y, int index, const TileElement* source, WallInfo* target)
     {
         const WallElement* wall = source->AsWall();
 
@@ -81,6 +71,7 @@ extern "C"
     // Writes the wall element details to the specified buffer.
     EXPORT void GetWallElementAt(int x, int y, int index, WallInfo* element)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = GetTileElementAt(x, y, index, TileElementType::Wall);
         SetWallInfo(x, y, index, source, element);
     }
@@ -88,6 +79,7 @@ extern "C"
     // Writes all the wall element details to the specified buffer.
     EXPORT int GetAllWallElementsAt(int x, int y, WallInfo* elements, int length)
     {
+        std::lock_guard lock(GetSimulationMutex());
         const TileElement* source = MapGetFirstElementAt(TileCoordsXY{ x, y });
         auto index = 0;
 
@@ -0,0 +1,113 @@
+#include "SpriteCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+struct SpriteCacheEntry
+{
+    uint64_t key;
+    std::vector<uint8_t> pixels;
+};
+
+static std::mutex _spriteCacheMutex;
+static std::list<SpriteCacheEntry> _spriteCacheEntries; // Most recently used in front.
+static std::unordered_map<uint64_t, std::list<SpriteCacheEntry>::iterator> _spriteCacheLookup;
+static size_t _spriteCacheBytes = 0;
+static size_t _spriteCacheCapacity = 64 * 1024 * 1024;
+static SpriteCacheStats _spriteCacheStats = {};
+
+// Combines the index with all remap colours and flags, as the raw 32-bit value drops the tertiary colour.
+// HasPrimary() is also true for tertiary remaps, so the primary flag is rebuilt from both.
+static uint64_t GetSpriteCacheKey(const ImageId imageId)
+{
+    const bool primaryFlag = imageId.HasPrimary() && !imageId.HasTertiary();
+
+    uint64_t key = imageId.GetIndex();
+    key |= static_cast<uint64_t>(imageId.GetPrimary()) << 32;
+    key |= static_cast<uint64_t>(imageId.GetSecondary()) << 40;
+    key |= static_cast<uint64_t>(imageId.GetTertiary()) << 48;
+    key |= static_cast<uint64_t>(primaryFlag) << 56;
+    key |= static_cast<uint64_t>(imageId.HasSecondary()) << 57;
+    key |= static_cast<uint64_t>(imageId.IsBlended()) << 58;
+    return key;
+}
+
+static void EvictToCapacity()
+{
+    while (_spriteCacheBytes > _spriteCacheCapacity && !_spriteCacheEntries.empty())
+    {
+        const SpriteCacheEntry& last = _spriteCacheEntries.back();
+        _spriteCacheBytes -= last.pixels.size();
+        _spriteCacheLookup.erase(last.key);
+        _spriteCacheEntries.pop_back();
+        _spriteCacheStats.evictions++;
+    }
+}
+
+static void CopyPixels(const std::vector<uint8_t>& pixels, uint8_t* target, size_t length)
+{
+    std::memcpy(target, pixels.data(), std::min(length, pixels.size()));
+}
+
+bool SpriteCacheCopy(const ImageId imageId, uint8_t* target, size_t length, const SpriteDecoder& decoder)
+{
+    const uint64_t key = GetSpriteCacheKey(imageId);
+    {
+        std::lock_guard lock(_spriteCacheMutex);
+
+        auto it = _spriteCacheLookup.find(key);
+        if (it != _spriteCacheLookup.end())
+        {
+            _spriteCacheEntries.splice(_spriteCacheEntries.begin(), _spriteCacheEntries, it->second);
+            CopyPixels(it->second->pixels, target, length);
+            _spriteCacheStats.hits++;
+            return true;
+        }
+        _spriteCacheStats.misses++;
+    }
+
+    // Decode outside of the lock, so other threads can keep hitting the cache in the meantime.
+    std::vector<uint8_t> pixels;
+    if (!decoder(imageId, pixels))
+        return false;
+
+    CopyPixels(pixels, target, length);
+
+    std::lock_guard lock(_spriteCacheMutex);
+    if (_spriteCacheLookup.find(key) == _spriteCacheLookup.end() && pixels.size() <= _spriteCacheCapacity)
+    {
+        _spriteCacheBytes += pixels.size();
+        _spriteCacheEntries.push_front({ key, std::move(pixels) });
+        _spriteCacheLookup.emplace(key, _spriteCacheEntries.begin());
+        EvictToCapacity();
+    }
+    return true;
+}
+
+void SpriteCacheSetCapacity(size_t bytes)
+{
+    std::lock_guard lock(_spriteCacheMutex);
+    _spriteCacheCapacity = bytes;
+    EvictToCapacity();
+}
+
+void SpriteCachePurge()
+{
+    std::lock_guard lock(_spriteCacheMutex);
+    _spriteCacheEntries.clear();
+    _spriteCacheLookup.clear();
+    _spriteCacheBytes = 0;
+}
+
+SpriteCacheStats SpriteCacheGetStats()
+{
+    std::lock_guard lock(_spriteCacheMutex);
+    SpriteCacheStats stats = _spriteCacheStats;
+    stats.entries = static_cast<uint32_t>(_spriteCacheEntries.size());
+    stats.bytes = static_cast<uint32_t>(_spriteCacheBytes);
+    stats.capacity = static_cast<uint32_t>(_spriteCacheCapacity);
+    return stats;
+}
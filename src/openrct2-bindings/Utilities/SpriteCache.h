@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <openrct2/drawing/ImageId.hpp>
+#include <vector>
+
+struct SpriteCacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint32_t entries;
+    uint32_t bytes;
+    uint32_t capacity;
+};
+
+// Decodes the pixels of a sprite into the specified buffer, returns false if the sprite does not exist.
+using SpriteDecoder = std::function<bool(const ImageId imageId, std::vector<uint8_t>& pixels)>;
+
+// Copies the cached pixels of the sprite into the target buffer, decoding and caching them first
+// if they were not requested before. Returns false if the sprite could not be decoded.
+bool SpriteCacheCopy(const ImageId imageId, uint8_t* target, size_t length, const SpriteDecoder& decoder);
+
+// Sets the maximum amount of pixel bytes to keep, evicting the least recently used sprites if needed.
+void SpriteCacheSetCapacity(size_t bytes);
+
+// Removes all cached sprites, for example when the loaded objects change.
+void SpriteCachePurge();
+
+SpriteCacheStats SpriteCacheGetStats();
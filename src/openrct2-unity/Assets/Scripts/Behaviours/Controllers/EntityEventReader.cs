@@ -0,0 +1,78 @@
+using System;
+using OpenRCT2.Bindings.Entities;
+
+#nullable enable
+
+namespace OpenRCT2.Behaviours.Controllers
+{
+    /// <summary>
+    /// Records spawned and removed entities while it exists, and hands them to the
+    /// subscribers every time it is updated.
+    /// </summary>
+    public sealed class EntityEventReader : IDisposable
+    {
+        const int _bufferSize = 1024;
+
+        readonly EntityEvent[] _buffer = new EntityEvent[_bufferSize];
+
+        bool _enabled;
+
+
+        /// <summary>
+        /// Invoked for every spawned or removed entity, in the order they happened.
+        /// </summary>
+        public event Action<EntityEvent>? EntityChanged;
+
+        /// <summary>
+        /// Invoked when events were dropped because they were not read in time, mirrored
+        /// entity state has to be rebuilt from the full entity lists.
+        /// </summary>
+        public event Action? Overflowed;
+
+
+        public EntityEventReader()
+        {
+            EntityRegistry.SetEntityEventsEnabled(true);
+            _enabled = true;
+        }
+
+
+        /// <summary>
+        /// Reads all events since the previous update and passes them to the subscribers.
+        /// </summary>
+        public void Update()
+        {
+            if (!_enabled)
+                return;
+
+            if (EntityRegistry.TakeEntityEventsOverflow())
+            {
+                Overflowed?.Invoke();
+            }
+
+            int count;
+            do
+            {
+                count = EntityRegistry.GetEntityEvents(_buffer);
+                for (var idx = 0; idx < count; idx++)
+                {
+                    EntityChanged?.Invoke(_buffer[idx]);
+                }
+            }
+            while (count == _buffer.Length);
+        }
+
+
+        /// <summary>
+        /// Stops recording events.
+        /// </summary>
+        public void Dispose()
+        {
+            if (!_enabled)
+                return;
+
+            _enabled = false;
+            EntityRegistry.SetEntityEventsEnabled(false);
+        }
+    }
+}
@@ -10,14 +10,18 @@ namespace OpenRCT2.Behaviours.Controllers
     /// </summary>
     public class GuestController : PeepController
     {
+        readonly EntityTransformsReader _transforms;
+
+
         /// <inheritdoc/>
-        public GuestController(Transform transform, GameObject prefab)
+        public GuestController(Transform transform, GameObject prefab, EntityTransformsReader transforms)
             : base(EntityType.Guest, transform, prefab)
         {
+            _transforms = transforms;
         }
 
         /// <inheritdoc/>
         protected override int UpdateEntities(PeepEntity[] entities)
-            => EntityRegistry.GetAllGuests(entities);
+            => _transforms.CopyGuests(entities);
     }
 }
@@ -1,3 +1,4 @@
+using OpenRCT2.Bindings.Entities;
 using OpenRCT2.Utilities;
 using UnityEngine;
 
@@ -12,18 +13,22 @@ public class PeepControllerScript : MonoBehaviour
     {
         [SerializeField, Required] GameObject _prefab = null!;
 
+        readonly EntityTransformsReader _transforms = new();
+
         GuestController? _guests;
         StaffController? _staff;
 
 
         void Start()
         {
-            _guests = new GuestController(transform, _prefab);
-            _staff = new StaffController(transform, _prefab);
+            _guests = new GuestController(transform, _prefab, _transforms);
+            _staff = new StaffController(transform, _prefab, _transforms);
         }
 
         void Update()
         {
+            // Positions are read from the published transforms, so this never waits on the simulation.
+            _transforms.Refresh();
             _guests?.Update();
             _staff?.Update();
         }
@@ -10,14 +10,18 @@ namespace OpenRCT2.Behaviours.Controllers
     /// </summary>
     public class StaffController : PeepController
     {
+        readonly EntityTransformsReader _transforms;
+
+
         /// <inheritdoc/>
-        public StaffController(Transform transform, GameObject prefab)
+        public StaffController(Transform transform, GameObject prefab, EntityTransformsReader transforms)
             : base(EntityType.Staff, transform, prefab)
         {
+            _transforms = transforms;
         }
 
         /// <inheritdoc/>
         protected override int UpdateEntities(PeepEntity[] entities)
-            => EntityRegistry.GetAllStaff(entities);
+            => _transforms.CopyStaff(entities);
     }
 }
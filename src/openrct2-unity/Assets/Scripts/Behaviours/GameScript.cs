@@ -1,4 +1,5 @@
 using System.IO;
+using OpenRCT2.Behaviours.Controllers;
 using OpenRCT2.Behaviours.Editor;
 using OpenRCT2.Bindings;
 using OpenRCT2.Generators.Sprites;
@@ -11,12 +12,33 @@ namespace OpenRCT2.Behaviours
     [RequireComponent(typeof(MapScript))]
     public class GameScript : MonoBehaviour
     {
+        /// <summary>
+        /// How the simulation is advanced.
+        /// </summary>
+        public enum SimulationMode
+        {
+            // One game tick per fixed update.
+            FixedUpdate,
+            // Ticks by the elapsed frame time, with entity positions interpolated in between.
+            Interpolated,
+            // Ticks on a background thread, independent of the frame rate.
+            Threaded
+        }
+
         // The relative path to the selected park file.
         public string? selectedPark;
 
+        [SerializeField] SimulationMode _simulationMode = SimulationMode.FixedUpdate;
+
         Game? _game;
 
 
+        /// <summary>
+        /// Spawned and removed entities, read after every game update.
+        /// </summary>
+        public EntityEventReader? EntityEvents { get; private set; }
+
+
         /// <summary>
         /// Starts the game based on the settings set in the editor.
         /// </summary>
@@ -60,7 +82,13 @@ void Start()
             var map = GetComponent<MapScript>();
             map.Generate();
 
+            EntityEvents = new EntityEventReader();
             _game = game;
+
+            if (_simulationMode == SimulationMode.Threaded)
+            {
+                game.StartThread();
+            }
         }
 
 
@@ -69,7 +97,24 @@ void Start()
         /// </summary>
         void FixedUpdate()
         {
-            _game?.Update();
+            if (_simulationMode == SimulationMode.FixedUpdate)
+            {
+                _game?.Update();
+            }
+        }
+
+
+        /// <summary>
+        /// Advances the game by the frame time when interpolating, and reads the entity
+        /// events of all ticks since the previous frame.
+        /// </summary>
+        void Update()
+        {
+            if (_simulationMode == SimulationMode.Interpolated)
+            {
+                _game?.Update(Time.deltaTime);
+            }
+            EntityEvents?.Update();
         }
 
 
@@ -78,6 +123,9 @@ void FixedUpdate()
         /// </summary>
         void OnDestroy()
         {
+            EntityEvents?.Dispose();
+            EntityEvents = null;
+
             _game?.ClosePark();
             Debug.Log("OpenRCT2 has shutdown.");
         }
@@ -0,0 +1,20 @@
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings.Entities
+{
+    /// <summary>
+    /// An entity that was spawned or removed since the previous read.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct EntityEvent
+    {
+        public readonly ushort entityId;
+        public readonly ushort generation;
+        public readonly byte type; // the native entity type, see EntityType for the common ones.
+
+        [MarshalAs(UnmanagedType.I1)]
+        public readonly bool removed;
+    }
+}
@@ -65,5 +65,47 @@ public static int GetAllVehicles(VehicleEntity[] buffer)
 
         [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
         static extern int GetAllVehicles([Out] VehicleEntity[] elements, int arraySize);
+
+
+        /// <summary>
+        /// Starts or stops recording spawned and removed entities for <see cref="GetEntityEvents"/>.
+        /// Disabled by default, events not read yet are dropped on every change.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetEntityEventsEnabled([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+
+        /// <summary>
+        /// Returns true once if entity events were dropped since the last call because
+        /// they were not read in time, after which any mirrored entity state is stale.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool TakeEntityEventsOverflow();
+
+
+        /// <summary>
+        /// Reads all entities spawned or removed since the last call into the specified
+        /// buffer, in the order they happened.
+        /// </summary>
+        public static int GetEntityEvents(EntityEvent[] buffer)
+            => GetEntityEvents(buffer, buffer.Length);
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern int GetEntityEvents([Out] EntityEvent[] events, int length);
+
+
+        /// <summary>
+        /// Gets pointers to the transforms of all guests, staff and vehicles as published
+        /// after the last game update, without copying them.
+        /// </summary>
+        public static EntityTransforms GetEntityTransforms()
+        {
+            GetEntityTransforms(out EntityTransforms transforms);
+            return transforms;
+        }
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void GetEntityTransforms(out EntityTransforms transforms);
     }
 }
@@ -0,0 +1,40 @@
+using System;
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings.Entities
+{
+    /// <summary>
+    /// Pointers to the most recently published entity transforms, stored as a struct of
+    /// arrays that is owned by the bindings. Entities are ordered as all guests, then all
+    /// staff, then all vehicles. The arrays stay valid until the next call to
+    /// <see cref="EntityRegistry.GetEntityTransforms"/>, also while the simulation runs
+    /// on its own thread.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct EntityTransforms
+    {
+        public readonly uint frame;
+        public readonly int guestCount;
+        public readonly int staffCount;
+        public readonly int vehicleCount;
+
+        public readonly IntPtr x;
+        public readonly IntPtr y;
+        public readonly IntPtr z;
+        public readonly IntPtr direction;
+        public readonly IntPtr pitch;
+        public readonly IntPtr banking;
+        public readonly IntPtr animationGroup;
+        public readonly IntPtr animationType;
+        public readonly IntPtr animationOffset;
+        public readonly IntPtr colour1;
+        public readonly IntPtr colour2;
+        public readonly IntPtr colour3;
+        public readonly IntPtr entityId;
+        public readonly IntPtr generation;
+
+        public int total => guestCount + staffCount + vehicleCount;
+    }
+}
@@ -0,0 +1,113 @@
+using System;
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings.Entities
+{
+    /// <summary>
+    /// Copies the published entity transforms into managed arrays, without taking the
+    /// simulation lock. The copy is refreshed at most once per published frame.
+    /// </summary>
+    public sealed class EntityTransformsReader
+    {
+        int[] _x = Array.Empty<int>();
+        int[] _y = Array.Empty<int>();
+        int[] _z = Array.Empty<int>();
+        byte[] _direction = Array.Empty<byte>();
+        byte[] _animationGroup = Array.Empty<byte>();
+        byte[] _animationType = Array.Empty<byte>();
+        byte[] _animationOffset = Array.Empty<byte>();
+        byte[] _colour1 = Array.Empty<byte>();
+        byte[] _colour2 = Array.Empty<byte>();
+        byte[] _colour3 = Array.Empty<byte>();
+        short[] _entityId = Array.Empty<short>();
+        short[] _generation = Array.Empty<short>();
+
+        uint _frame;
+        int _guestCount;
+        int _staffCount;
+
+
+        /// <summary>
+        /// Fetches the most recently published transforms if they are newer than the copy.
+        /// </summary>
+        public void Refresh()
+        {
+            var transforms = EntityRegistry.GetEntityTransforms();
+            if (transforms.frame == _frame)
+                return;
+
+            var count = transforms.guestCount + transforms.staffCount;
+            if (count > _x.Length)
+            {
+                var capacity = Math.Max(count, _x.Length * 2);
+                Array.Resize(ref _x, capacity);
+                Array.Resize(ref _y, capacity);
+                Array.Resize(ref _z, capacity);
+                Array.Resize(ref _direction, capacity);
+                Array.Resize(ref _animationGroup, capacity);
+                Array.Resize(ref _animationType, capacity);
+                Array.Resize(ref _animationOffset, capacity);
+                Array.Resize(ref _colour1, capacity);
+                Array.Resize(ref _colour2, capacity);
+                Array.Resize(ref _colour3, capacity);
+                Array.Resize(ref _entityId, capacity);
+                Array.Resize(ref _generation, capacity);
+            }
+
+            // Only guests and staff are copied, they come first in the published arrays.
+            if (count > 0)
+            {
+                Marshal.Copy(transforms.x, _x, 0, count);
+                Marshal.Copy(transforms.y, _y, 0, count);
+                Marshal.Copy(transforms.z, _z, 0, count);
+                Marshal.Copy(transforms.direction, _direction, 0, count);
+                Marshal.Copy(transforms.animationGroup, _animationGroup, 0, count);
+                Marshal.Copy(transforms.animationType, _animationType, 0, count);
+                Marshal.Copy(transforms.animationOffset, _animationOffset, 0, count);
+                Marshal.Copy(transforms.colour1, _colour1, 0, count);
+                Marshal.Copy(transforms.colour2, _colour2, 0, count);
+                Marshal.Copy(transforms.colour3, _colour3, 0, count);
+                Marshal.Copy(transforms.entityId, _entityId, 0, count);
+                Marshal.Copy(transforms.generation, _generation, 0, count);
+            }
+
+            _frame = transforms.frame;
+            _guestCount = transforms.guestCount;
+            _staffCount = transforms.staffCount;
+        }
+
+
+        /// <summary>
+        /// Copies the guests of the last refresh into the specified buffer, returns the
+        /// amount of guests copied.
+        /// </summary>
+        public int CopyGuests(PeepEntity[] buffer)
+            => CopyPeeps(0, _guestCount, buffer);
+
+
+        /// <summary>
+        /// Copies the staff of the last refresh into the specified buffer, returns the
+        /// amount of staff copied.
+        /// </summary>
+        public int CopyStaff(PeepEntity[] buffer)
+            => CopyPeeps(_guestCount, _staffCount, buffer);
+
+
+        int CopyPeeps(int start, int count, PeepEntity[] buffer)
+        {
+            count = Math.Min(count, buffer.Length);
+            for (var idx = 0; idx < count; idx++)
+            {
+                var source = start + idx;
+                buffer[idx] = new PeepEntity(
+                    _x[source], _y[source], _z[source], _direction[source],
+                    _colour1[source], _colour2[source], _colour3[source],
+                    _animationGroup[source], _animationType[source], _animationOffset[source],
+                    (ushort)_entityId[source], (ushort)_generation[source]);
+            }
+            return count;
+        }
+    }
+}
@@ -22,5 +22,25 @@ namespace OpenRCT2.Bindings.Entities
         public readonly byte animationGroup;
         public readonly byte animationType;
         public readonly byte animationOffset;
+
+        public readonly ushort entityId;
+        public readonly ushort generation;
+
+
+        public PeepEntity(int x, int y, int z, byte direction, byte tshirtColour, byte trousersColour, byte accessoryColour, byte animationGroup, byte animationType, byte animationOffset, ushort entityId, ushort generation)
+        {
+            this.x = x;
+            this.y = y;
+            this.z = z;
+            this.direction = direction;
+            this.tshirtColour = tshirtColour;
+            this.trousersColour = trousersColour;
+            this.accessoryColour = accessoryColour;
+            this.animationGroup = animationGroup;
+            this.animationType = animationType;
+            this.animationOffset = animationOffset;
+            this.entityId = entityId;
+            this.generation = generation;
+        }
     }
 }
@@ -20,5 +20,8 @@ namespace OpenRCT2.Bindings.Entities
         public readonly ushort trackType; // current track type its on.
         public readonly byte trackDirection; // the direction this track type is in.
         public readonly ushort trackProgress; // current track node index.
+
+        public readonly ushort entityId;
+        public readonly ushort generation; // changes when the entity id is reused by another entity.
     }
 }
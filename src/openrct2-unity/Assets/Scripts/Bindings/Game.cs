@@ -1,3 +1,4 @@
+using System;
 using System.Runtime.InteropServices;
 using UnityEngine;
 
@@ -57,6 +58,75 @@ public void Update()
         }
 
 
+        /// <summary>
+        /// Advances the game by the elapsed real time in fixed ticks, running at most
+        /// <paramref name="maxTicks"/> ticks. Returns the interpolation alpha between the
+        /// last two ticks, entity positions are already interpolated by this amount.
+        /// </summary>
+        public float Update(float elapsedSeconds, int maxTicks = 4)
+        {
+            return PerformGameUpdateFor(elapsedSeconds, maxTicks);
+        }
+
+
+        /// <summary>
+        /// Moves the simulation onto a background thread, after which <see cref="Update()"/>
+        /// does nothing until <see cref="StopThread"/> is called.
+        /// </summary>
+        public void StartThread()
+        {
+            StartSimulationThread();
+        }
+
+
+        /// <summary>
+        /// Stops the background simulation thread. Returns false without stopping while a
+        /// <see cref="SimulationLock"/> is held, as the thread could not finish its tick.
+        /// </summary>
+        public bool StopThread()
+            => StopSimulationThread();
+
+
+        /// <summary>
+        /// Pauses the background simulation between two ticks until the returned lock is
+        /// disposed. Every call reading live game state already locks on its own, hold this
+        /// to keep several reads consistent with each other.
+        /// </summary>
+        public SimulationLock Lock()
+            => SimulationLock.Acquire();
+
+
+        /// <summary>
+        /// Holds the simulation paused until disposed. Only <see cref="Lock"/> can create
+        /// one, and disposing it more than once unlocks only once.
+        /// </summary>
+        public sealed class SimulationLock : IDisposable
+        {
+            bool _locked;
+
+
+            SimulationLock()
+            {
+                LockSimulation();
+                _locked = true;
+            }
+
+
+            internal static SimulationLock Acquire()
+                => new SimulationLock();
+
+
+            public void Dispose()
+            {
+                if (!_locked)
+                    return;
+
+                _locked = false;
+                UnlockSimulation();
+            }
+        }
+
+
         /// <summary>
         /// Starts the game with the specified folder paths paths.
         /// </summary>
@@ -80,6 +150,42 @@ public void Update()
         static extern void PerformGameUpdate();
 
 
+        /// <summary>
+        /// Advances the game by the elapsed real time in a bounded amount of fixed ticks.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern float PerformGameUpdateFor(float elapsedSeconds, int maxTicks);
+
+
+        /// <summary>
+        /// Starts ticking the simulation on a background thread.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void StartSimulationThread();
+
+
+        /// <summary>
+        /// Stops the background simulation thread.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        static extern bool StopSimulationThread();
+
+
+        /// <summary>
+        /// Pauses the background simulation between two ticks.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void LockSimulation();
+
+
+        /// <summary>
+        /// Resumes the background simulation.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void UnlockSimulation();
+
+
         /// <summary>
         /// Shuts down the game.
         /// </summary>
@@ -96,5 +96,45 @@ public static byte[] GetTexturePixels(uint imageIndex, byte colour1, byte colour
             GetTexturePixels(imageIndex, colour1, colour2, colour3, byteBuffer, total);
             return byteBuffer;
         }
+
+
+        /// <summary>
+        /// Gets the hit and miss counters and the current size of the sprite cache.
+        /// </summary>
+        public static SpriteCacheStats GetSpriteCacheStats()
+        {
+            GetSpriteCacheStats(out SpriteCacheStats stats);
+            return stats;
+        }
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void GetSpriteCacheStats(out SpriteCacheStats stats);
+
+
+        /// <summary>
+        /// Sets the maximum amount of pixel bytes the sprite cache may hold.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetSpriteCacheCapacity(uint bytes);
+
+
+        /// <summary>
+        /// Removes all decoded sprites from the sprite cache.
+        /// </summary>
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void PurgeSpriteCache();
+
+
+        /// <summary>
+        /// Packs and renders the requested sprites into the atlas page of the specified size, writing
+        /// the location of each sprite to the rects buffer. Returns the amount of requests that fitted,
+        /// the remaining requests can be baked into another page. Returns -1 if the atlas size is
+        /// not positive.
+        /// </summary>
+        public static int BakeSpriteAtlas(SpriteRequest[] requests, byte[] atlas, int atlasWidth, int atlasHeight, SpriteRect[] rects)
+            => BakeSpriteAtlas(requests, requests.Length, atlas, atlasWidth, atlasHeight, rects);
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern int BakeSpriteAtlas([In] SpriteRequest[] requests, int count, [Out] byte[] atlas, int atlasWidth, int atlasHeight, [Out] SpriteRect[] rects);
     }
 }
@@ -0,0 +1,21 @@
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings.Graphics
+{
+    /// <summary>
+    /// Counters and size of the cache of decoded sprites in the bindings.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct SpriteCacheStats
+    {
+        public readonly ulong hits;
+        public readonly ulong misses;
+        public readonly ulong evictions;
+
+        public readonly uint entries;
+        public readonly uint bytes;
+        public readonly uint capacity;
+    }
+}
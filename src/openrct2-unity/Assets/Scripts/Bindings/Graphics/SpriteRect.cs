@@ -0,0 +1,25 @@
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings.Graphics
+{
+    /// <summary>
+    /// Location of a baked sprite within an atlas, with the origin in the bottom left corner.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct SpriteRect
+    {
+        public readonly int x;
+        public readonly int y;
+
+        // Width + height of the sprite, zero if the sprite could not be baked.
+        public readonly short width;
+        public readonly short height;
+
+        // The x and y offset that is used to draw the sprite in
+        // the correct position.
+        public readonly short offsetX;
+        public readonly short offsetY;
+    }
+}
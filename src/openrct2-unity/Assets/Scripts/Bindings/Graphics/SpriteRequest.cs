@@ -0,0 +1,27 @@
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings.Graphics
+{
+    /// <summary>
+    /// A sprite to bake into an atlas, with optional remap colours.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct SpriteRequest
+    {
+        public readonly uint imageIndex;
+        public readonly byte colour1;
+        public readonly byte colour2;
+        public readonly byte colour3;
+
+
+        public SpriteRequest(uint imageIndex, byte colour1, byte colour2, byte colour3)
+        {
+            this.imageIndex = imageIndex;
+            this.colour1 = colour1;
+            this.colour2 = colour2;
+            this.colour3 = colour3;
+        }
+    }
+}
@@ -0,0 +1,274 @@
+using OpenRCT2.Bindings.TileElements;
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings
+{
+    /// <summary>
+    /// Reads all tile elements within a rectangle of the map in a single native call.
+    /// </summary>
+    public static class MapSnapshot
+    {
+        // Has to match the layout version in the bindings.
+        const uint Version = 2;
+
+
+        /// <summary>
+        /// The amount of tiles along each edge of a chunk.
+        /// </summary>
+        public const int ChunkSize = 16;
+
+
+        /// <summary>
+        /// Loads all tiles within the specified chunk, indexed relative to the chunk's first tile.
+        /// The version can be compared to <see cref="GetChunkVersions"/> later on to find out
+        /// whether anything in the chunk has changed since.
+        /// </summary>
+        public static Tile[,] GetChunk(int chunkX, int chunkY, out uint version)
+        {
+            var allocations = new List<IntPtr>();
+            try
+            {
+                ChunkInfo chunk;
+                Buffers snapshot;
+
+                // Hold the simulation still, so the version matches the tiles that are returned.
+                using (Game.SimulationLock.Acquire())
+                {
+                    GetMapChunkInfo(chunkX, chunkY, out chunk);
+                    snapshot = WriteSnapshot(chunk.x, chunk.y, chunk.width, chunk.height, allocations);
+                }
+
+                version = chunk.version;
+                return ReadSnapshot(chunk.x, chunk.y, chunk.width, chunk.height, in snapshot);
+            }
+            finally
+            {
+                Free(allocations);
+            }
+        }
+
+
+        /// <summary>
+        /// Writes the current versions of all chunks into the buffer, indexed as
+        /// [chunkX * chunksY + chunkY]. Returns the amount of chunks on the map, which
+        /// may be larger than the buffer.
+        /// </summary>
+        public static int GetChunkVersions(uint[] versions)
+        {
+            return GetMapChunkVersions(versions, versions.Length);
+        }
+
+
+        /// <summary>
+        /// Loads all tiles within the specified rectangle, indexed as [x - startX, y - startY].
+        /// </summary>
+        public static Tile[,] GetTiles(int x, int y, int width, int height)
+        {
+            var allocations = new List<IntPtr>();
+            try
+            {
+                Buffers snapshot;
+
+                // Hold the simulation still, so no tick changes the tiles between counting and writing them.
+                using (Game.SimulationLock.Acquire())
+                {
+                    snapshot = WriteSnapshot(x, y, width, height, allocations);
+                }
+
+                return ReadSnapshot(x, y, width, height, in snapshot);
+            }
+            finally
+            {
+                Free(allocations);
+            }
+        }
+
+
+        // Counts the elements in the rectangle and lets the bindings write them into newly
+        // allocated buffers, which are added to the allocations. Requires the simulation lock.
+        static Buffers WriteSnapshot(int x, int y, int width, int height, List<IntPtr> allocations)
+        {
+            IntPtr Allocate<T>(int count)
+            {
+                var pointer = Marshal.AllocHGlobal(Marshal.SizeOf<T>() * Math.Max(count, 1));
+                allocations.Add(pointer);
+                return pointer;
+            }
+
+            GetMapSnapshotCounts(x, y, width, height, out var counts);
+            if (counts.version != Version)
+            {
+                throw new InvalidOperationException($"Map snapshot version {counts.version} does not match expected version {Version}.");
+            }
+
+            var offsetCount = counts.tiles + 1;
+            var snapshot = new Buffers
+            {
+                version = Version,
+                capacityOffsets = offsetCount,
+                capacityElements = counts.elements,
+                capacitySurfaces = counts.surfaces,
+                capacityPaths = counts.paths,
+                capacityTracks = counts.tracks,
+                capacitySmallScenery = counts.smallScenery,
+                capacityWalls = counts.walls,
+                elementOffsets = Allocate<int>(offsetCount),
+                elements = Allocate<TileElementInfo>(counts.elements),
+                surfaceOffsets = Allocate<int>(offsetCount),
+                surfaces = Allocate<SurfaceInfo>(counts.surfaces),
+                pathOffsets = Allocate<int>(offsetCount),
+                paths = Allocate<PathInfo>(counts.paths),
+                trackOffsets = Allocate<int>(offsetCount),
+                tracks = Allocate<TrackInfo>(counts.tracks),
+                smallSceneryOffsets = Allocate<int>(offsetCount),
+                smallScenery = Allocate<SmallSceneryInfo>(counts.smallScenery),
+                wallOffsets = Allocate<int>(offsetCount),
+                walls = Allocate<WallInfo>(counts.walls),
+            };
+
+            if (GetMapSnapshot(x, y, width, height, ref snapshot) < 0)
+            {
+                throw new InvalidOperationException($"Failed to read map snapshot of {width}x{height} tiles at {x}, {y}.");
+            }
+            return snapshot;
+        }
+
+
+        // Converts the written buffers into tiles, does not need the simulation lock.
+        static Tile[,] ReadSnapshot(int x, int y, int width, int height, in Buffers snapshot)
+        {
+            var offsetCount = snapshot.capacityOffsets;
+            var elementOffsets = ReadOffsets(snapshot.elementOffsets, offsetCount);
+            var surfaceOffsets = ReadOffsets(snapshot.surfaceOffsets, offsetCount);
+            var pathOffsets = ReadOffsets(snapshot.pathOffsets, offsetCount);
+            var trackOffsets = ReadOffsets(snapshot.trackOffsets, offsetCount);
+            var smallSceneryOffsets = ReadOffsets(snapshot.smallSceneryOffsets, offsetCount);
+            var wallOffsets = ReadOffsets(snapshot.wallOffsets, offsetCount);
+
+            var tiles = new Tile[width, height];
+            for (var tx = 0; tx < width; tx++)
+            {
+                for (var ty = 0; ty < height; ty++)
+                {
+                    var index = tx * height + ty;
+                    tiles[tx, ty] = new Tile(x + tx, y + ty,
+                        ReadRecords<TileElementInfo>(snapshot.elements, elementOffsets, index),
+                        ReadRecords<SurfaceInfo>(snapshot.surfaces, surfaceOffsets, index),
+                        ReadRecords<PathInfo>(snapshot.paths, pathOffsets, index),
+                        ReadRecords<TrackInfo>(snapshot.tracks, trackOffsets, index),
+                        ReadRecords<SmallSceneryInfo>(snapshot.smallScenery, smallSceneryOffsets, index),
+                        ReadRecords<WallInfo>(snapshot.walls, wallOffsets, index));
+                }
+            }
+            return tiles;
+        }
+
+
+        static void Free(List<IntPtr> allocations)
+        {
+            foreach (var pointer in allocations)
+            {
+                Marshal.FreeHGlobal(pointer);
+            }
+        }
+
+
+        static int[] ReadOffsets(IntPtr source, int count)
+        {
+            var offsets = new int[count];
+            Marshal.Copy(source, offsets, 0, count);
+            return offsets;
+        }
+
+
+        static T[] ReadRecords<T>(IntPtr source, int[] offsets, int tile) where T : struct
+        {
+            var start = offsets[tile];
+            var count = offsets[tile + 1] - start;
+            if (count == 0)
+            {
+                return Array.Empty<T>();
+            }
+
+            var size = Marshal.SizeOf<T>();
+            var records = new T[count];
+            for (var i = 0; i < count; i++)
+            {
+                records[i] = Marshal.PtrToStructure<T>(IntPtr.Add(source, (start + i) * size));
+            }
+            return records;
+        }
+
+
+        [StructLayout(LayoutKind.Sequential)]
+        readonly struct Counts
+        {
+            public readonly uint version;
+            public readonly int tiles;
+            public readonly int elements;
+            public readonly int surfaces;
+            public readonly int paths;
+            public readonly int tracks;
+            public readonly int smallScenery;
+            public readonly int walls;
+        }
+
+
+        [StructLayout(LayoutKind.Sequential)]
+        readonly struct ChunkInfo
+        {
+            public readonly int x;
+            public readonly int y;
+            public readonly int width;
+            public readonly int height;
+            public readonly uint version;
+        }
+
+
+        [StructLayout(LayoutKind.Sequential)]
+        struct Buffers
+        {
+            public uint version;
+            public int capacityOffsets;
+            public int capacityElements;
+            public int capacitySurfaces;
+            public int capacityPaths;
+            public int capacityTracks;
+            public int capacitySmallScenery;
+            public int capacityWalls;
+
+            public IntPtr elementOffsets;
+            public IntPtr elements;
+            public IntPtr surfaceOffsets;
+            public IntPtr surfaces;
+            public IntPtr pathOffsets;
+            public IntPtr paths;
+            public IntPtr trackOffsets;
+            public IntPtr tracks;
+            public IntPtr smallSceneryOffsets;
+            public IntPtr smallScenery;
+            public IntPtr wallOffsets;
+            public IntPtr walls;
+        }
+
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void GetMapSnapshotCounts(int x, int y, int width, int height, out Counts counts);
+
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern int GetMapSnapshot(int x, int y, int width, int height, ref Buffers snapshot);
+
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern void GetMapChunkInfo(int chunkX, int chunkY, out ChunkInfo chunk);
+
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern int GetMapChunkVersions([Out] uint[] versions, int length);
+    }
+}
@@ -1,6 +1,7 @@
 using System;
 using System.Runtime.InteropServices;
 using OpenRCT2.Bindings.TileElements;
+using UnityEngine;
 
 #nullable enable
 
@@ -82,10 +83,24 @@ public static WallInfo GetWallElementAt(int x, int y, int index)
         }
 
 
+        /// <summary>
+        /// Moves the coordinates of all tiles that changed since the last call into the buffer,
+        /// returns the amount of tiles written. Tiles that did not fit are returned on the next call.
+        /// Element removals are only reported through the game action or tile invalidation that
+        /// caused them, a removal that does neither does not show up here.
+        /// </summary>
+        public static int GetChangedTiles(Vector2Int[] buffer)
+            => GetChangedTiles(buffer, buffer.Length);
+
+
         [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
         static extern IntPtr GetParkName();
 
 
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern int GetChangedTiles([Out] Vector2Int[] tiles, int length);
+
+
         [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
         static extern int GetMapSize(out MapSize size);
 
@@ -0,0 +1,110 @@
+using System;
+using System.Runtime.InteropServices;
+
+#nullable enable
+
+namespace OpenRCT2.Bindings
+{
+    /// <summary>
+    /// The surface of every tile within a rectangle of the map, stored as dense arrays that
+    /// are indexed x-major: tile index = (x - startX) * height + (y - startY).
+    /// </summary>
+    public class SurfaceHeightfield
+    {
+        public readonly int startX;
+        public readonly int startY;
+        public readonly int width;
+        public readonly int height;
+
+        /// <summary>
+        /// Four corner heights per tile in direction order, in base height units.
+        /// </summary>
+        public readonly ushort[] cornerHeights;
+
+        /// <summary>
+        /// Water height per tile in base height units, or 0 if there is no water.
+        /// </summary>
+        public readonly ushort[] waterHeights;
+
+        public readonly ushort[] surfaceObjects;
+        public readonly ushort[] edgeObjects;
+        public readonly byte[] ownership;
+
+
+        /// <summary>
+        /// Allocates a heightfield for the specified rectangle of tiles, call
+        /// <see cref="Read"/> to fill it.
+        /// </summary>
+        public SurfaceHeightfield(int startX, int startY, int width, int height)
+        {
+            this.startX = startX;
+            this.startY = startY;
+            this.width = width;
+            this.height = height;
+
+            var tiles = width * height;
+            cornerHeights = new ushort[tiles * 4];
+            waterHeights = new ushort[tiles];
+            surfaceObjects = new ushort[tiles];
+            edgeObjects = new ushort[tiles];
+            ownership = new byte[tiles];
+        }
+
+
+        /// <summary>
+        /// Overwrites the arrays with the current surface of the map in a single native call,
+        /// so the arrays can be reused across terrain rebuilds.
+        /// </summary>
+        public void Read()
+        {
+            var handles = new[]
+            {
+                GCHandle.Alloc(cornerHeights, GCHandleType.Pinned),
+                GCHandle.Alloc(waterHeights, GCHandleType.Pinned),
+                GCHandle.Alloc(surfaceObjects, GCHandleType.Pinned),
+                GCHandle.Alloc(edgeObjects, GCHandleType.Pinned),
+                GCHandle.Alloc(ownership, GCHandleType.Pinned),
+            };
+            try
+            {
+                var buffers = new Buffers
+                {
+                    capacity = width * height,
+                    cornerHeights = handles[0].AddrOfPinnedObject(),
+                    waterHeights = handles[1].AddrOfPinnedObject(),
+                    surfaceObjects = handles[2].AddrOfPinnedObject(),
+                    edgeObjects = handles[3].AddrOfPinnedObject(),
+                    ownership = handles[4].AddrOfPinnedObject(),
+                };
+
+                if (GetSurfaceHeightfield(startX, startY, width, height, ref buffers) < 0)
+                {
+                    throw new InvalidOperationException($"Failed to read surface heightfield of {width}x{height} tiles at {startX}, {startY}.");
+                }
+            }
+            finally
+            {
+                foreach (var handle in handles)
+                {
+                    handle.Free();
+                }
+            }
+        }
+
+
+        [StructLayout(LayoutKind.Sequential)]
+        struct Buffers
+        {
+            public int capacity;
+            public IntPtr cornerHeights;
+            public IntPtr waterHeights;
+            public IntPtr surfaceObjects;
+            public IntPtr edgeObjects;
+            public IntPtr ownership;
+        }
+
+
+        [DllImport(Plugin.FileName, CallingConvention = CallingConvention.Cdecl)]
+        static extern int GetSurfaceHeightfield(int startX, int startY, int width, int height, ref Buffers field);
+    }
+}
@@ -34,6 +34,20 @@ public Tile(int x, int y)
             walls = GetElementsAt<WallInfo>(x, y, counts.walls, GetAllWallElementsAt);
         }
 
+
+        internal Tile(int x, int y, TileElementInfo[] elements, SurfaceInfo[] surfaces, PathInfo[] paths, TrackInfo[] tracks, SmallSceneryInfo[] smallScenery, WallInfo[] walls)
+        {
+            this.x = x;
+            this.y = y;
+
+            this.elements = elements;
+            this.surfaces = surfaces;
+            this.paths = paths;
+            this.tracks = tracks;
+            this.smallScenery = smallScenery;
+            this.walls = walls;
+        }
+
         T[] GetElementsAt<T>(int x, int y, int count, Func<int, int, T[], int, int> getter) where T : struct
         {
             if (count == 0)
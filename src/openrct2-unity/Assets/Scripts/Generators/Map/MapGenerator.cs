@@ -32,19 +32,10 @@ public IEnumerator<LoadStatus> GenerateMap(Transform parent)
             // Remove map border
             var width = size.width - 2;
             var height = size.height - 2;
-            var total = width * height;
-            var tiles = new Tile[width, height];
 
-            // Load in all tiles for the map
-            for (var x = 0; x < width; x++)
-            {
-                for (var y = 0; y < width; y++)
-                {
-                    yield return new LoadStatus("Loading tiles...", x * width + y, total);
-
-                    tiles[x, y] = new Tile(x + 1, y + 1); // skip border
-                }
-            }
+            // Load in all tiles for the map in one go, skipping the border
+            yield return new LoadStatus("Loading tiles...", 0, 1);
+            var tiles = MapSnapshot.GetTiles(1, 1, width, height);
 
             // Create the map and run the object generators
             var map = new Map(tiles);
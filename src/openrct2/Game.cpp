@@ -72,7 +72,9 @@
 #include "world/Scenery.h"
 #include "world/Surface.h"
 
+#include <chrono>
 #include <cstdio>
+#include <future>
 #include <iterator>
 #include <memory>
 
@@ -563,8 +565,27 @@ static void LimitAutosaveCount(const size_t numberOfFilesToKeep, bool processLan
     }
 }
 
+// Compression and writing of the last autosave, which runs on a background thread.
+static std::future<bool> _autosaveFuture;
+
+void GameAutosaveUpdate()
+{
+    if (!_autosaveFuture.valid() || _autosaveFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    if (!_autosaveFuture.get())
+        Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+}
+
 void GameAutosave()
 {
+    GameAutosaveUpdate();
+    if (_autosaveFuture.valid())
+    {
+        LOG_WARNING("Skipping autosave, the previous autosave is still being written.");
+        return;
+    }
+
     auto subDirectory = DIRID::SAVE;
     const char* fileExtension = ".park";
     uint32_t saveFlags = 0x80000000;
@@ -602,8 +623,14 @@ void GameAutosave()
 
     auto& gameState = GetGameState();
 
-    if (!ScenarioSave(gameState, path, saveFlags))
+    // Only serialising the park has to happen on the game thread, compressing and writing it does not.
+    auto writeAutosave = ScenarioSaveDeferred(gameState, path, saveFlags);
+    if (!writeAutosave)
+    {
         Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
+        return;
+    }
+    _autosaveFuture = std::async(std::launch::async, std::move(writeAutosave));
 }
 
 static void GameLoadOrQuitNoSavePromptCallback(int32_t result, const utf8* path)
@@ -58,6 +58,12 @@ public:
 
     virtual void Import(OpenRCT2::GameState_t& gameState) = 0;
     virtual bool GetDetails(ScenarioIndexEntry* dst) = 0;
+
+    // Loads only what is needed for GetDetails, importers that can not do so load the whole scenario.
+    virtual void LoadDetails(const u8string& path)
+    {
+        LoadScenario(path, true);
+    }
 };
 
 namespace OpenRCT2::ParkImporter
@@ -19,6 +19,7 @@
 #include "../entity/MoneyEffect.h"
 #include "../localisation/Formatter.h"
 #include "../network/network.h"
+#include "../peep/GuestPathfinding.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
 #include "../scenario/Scenario.h"
@@ -27,6 +28,7 @@
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
+#include "../world/MapChanges.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 
@@ -368,6 +370,17 @@ namespace OpenRCT2::GameActions
 
             LogActionFinish(logContext, action, result);
 
+            if (result.Error == GameActions::Status::Ok)
+            {
+                // Any action may have changed the paths guests walk on
+                PathFinding::ClearSearchCache();
+
+                if (!result.Position.IsNull())
+                {
+                    MapChangesMarkTile(result.Position);
+                }
+            }
+
             // If not top level just give away the result.
             if (!topLevel)
                 return result;
@@ -22,8 +22,11 @@
 
 #include <chrono>
 #include <list>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -37,18 +40,32 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct FileRecord
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<FileRecord> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<FileRecord>&& files) noexcept
             : Stats(stats)
             , Files(std::move(files))
         {
         }
     };
 
+    // A file as stored in the index, files that did not produce an item are kept so they are not loaded again.
+    struct IndexedFile
+    {
+        FileRecord File;
+        std::optional<TItem> Item;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -57,11 +74,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -98,30 +115,35 @@ public:
 
     /**
      * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * the items are loaded from the index and returned, otherwise the index is updated,
+     * only loading the files that were added or changed since it was written.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto [upToDate, indexedFiles] = ReadIndexFile(language, scanResult.Stats);
+        if (upToDate)
         {
             // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            std::vector<TItem> items;
+            for (auto& indexedFile : indexedFiles)
+            {
+                if (indexedFile.Item.has_value())
+                {
+                    items.push_back(std::move(indexedFile.Item.value()));
+                }
+            }
+            return items;
         }
-        return items;
+
+        // Index was not loaded or is out of date
+        return Build(language, scanResult, std::move(indexedFiles));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -140,7 +162,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileRecord> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = OpenRCT2::Path::GetAbsolute(directory);
@@ -160,36 +182,64 @@ private:
                 stats.FileDateModifiedChecksum = OpenRCT2::Numerics::ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo.Size, fileInfo.LastModified });
             }
         }
         return ScanResult(stats, std::move(files));
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<TItem> Build(
+        int32_t language, const ScanResult& scanResult, std::vector<IndexedFile>&& previousFiles) const
     {
-        std::vector<TItem> allItems;
-        OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
-
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        // Reuse the items of files that have not changed since the index was written
+        std::unordered_map<std::string_view, IndexedFile*> previousFilesByPath;
+        for (auto& previousFile : previousFiles)
+        {
+            previousFilesByPath.emplace(previousFile.File.Path, &previousFile);
+        }
+
+        std::vector<IndexedFile> indexedFiles(scanResult.Files.size());
+        std::vector<size_t> changedFiles;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
+        {
+            const auto& file = scanResult.Files[i];
+            indexedFiles[i].File = file;
+
+            auto it = previousFilesByPath.find(file.Path);
+            if (it != previousFilesByPath.end() && it->second->File.Size == file.Size
+                && it->second->File.LastModified == file.LastModified)
+            {
+                indexedFiles[i].Item = std::move(it->second->Item);
+            }
+            else
+            {
+                changedFiles.push_back(i);
+            }
+        }
+
+        if (previousFiles.empty())
+        {
+            OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), changedFiles.size());
+        }
+        else
+        {
+            OpenRCT2::Console::WriteLine(
+                "Updating %s (%zu of %zu items)", _name.c_str(), changedFiles.size(), scanResult.Files.size());
+        }
+
+        const size_t totalCount = changedFiles.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
-            std::mutex mtx;
             std::atomic<size_t> processed{ 0 };
 
-            for (size_t i = 0; i < totalCount; i++)
+            for (const auto index : changedFiles)
             {
-                jobPool.AddTask([&, index = i]() {
-                    const auto& filePath = scanResult.Files.at(index);
-
-                    if (auto item = Create(language, filePath); item.has_value())
-                    {
-                        std::lock_guard lock(mtx);
-                        allItems.push_back(std::move(item.value()));
-                    }
+                jobPool.AddTask([&, index]() {
+                    auto& indexedFile = indexedFiles[index];
+                    indexedFile.Item = Create(language, indexedFile.File.Path);
 
                     processed++;
                 });
@@ -200,7 +250,16 @@ private:
             });
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, indexedFiles);
+
+        std::vector<TItem> allItems;
+        for (auto& indexedFile : indexedFiles)
+        {
+            if (indexedFile.Item.has_value())
+            {
+                allItems.push_back(std::move(indexedFile.Item.value()));
+            }
+        }
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
@@ -209,10 +268,14 @@ private:
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    /**
+     * Reads all files stored in the index. The first value is whether the directory is unchanged since the index
+     * was written, the files are returned either way so they can be reused when updating the index.
+     */
+    std::tuple<bool, std::vector<IndexedFile>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        bool upToDate = false;
+        std::vector<IndexedFile> indexedFiles;
         if (OpenRCT2::File::Exists(_indexPath))
         {
             try
@@ -220,26 +283,38 @@ private:
                 LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, check if the index can be used at all
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    indexedFiles.reserve(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        IndexedFile indexedFile;
+                        bool hasItem = false;
+                        ds << indexedFile.File.Path;
+                        ds << indexedFile.File.Size;
+                        ds << indexedFile.File.LastModified;
+                        ds << hasItem;
+                        if (hasItem)
+                        {
+                            TItem item;
+                            Serialise(ds, item);
+                            indexedFile.Item = std::move(item);
+                        }
+                        indexedFiles.push_back(std::move(indexedFile));
                     }
-                    loadedItems = true;
+
+                    // Check if we need to re-scan
+                    upToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
                 }
-                else
+
+                if (!upToDate)
                 {
                     OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
                 }
@@ -248,12 +323,14 @@ private:
             {
                 OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 OpenRCT2::Console::Error::WriteLine("%s", e.what());
+                upToDate = false;
+                indexedFiles.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return std::make_tuple(upToDate, std::move(indexedFiles));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<IndexedFile>& indexedFiles) const
     {
         try
         {
@@ -268,14 +345,22 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumFiles = static_cast<uint32_t>(indexedFiles.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            // Write files and their items
+            for (const auto& indexedFile : indexedFiles)
             {
-                Serialise(ds, item);
+                bool hasItem = indexedFile.Item.has_value();
+                ds << indexedFile.File.Path;
+                ds << indexedFile.File.Size;
+                ds << indexedFile.File.LastModified;
+                ds << hasItem;
+                if (hasItem)
+                {
+                    Serialise(ds, indexedFile.Item.value());
+                }
             }
         }
         catch (const std::exception& e)
@@ -13,10 +13,12 @@
 #include "Crypt.h"
 #include "FileStream.h"
 #include "Identifier.hpp"
+#include "JobPool.h"
 #include "MemoryStream.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <stack>
 #include <type_traits>
@@ -35,6 +37,9 @@ namespace OpenRCT2
 
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
+        // Every chunk is gzipped on its own, so chunks can be compressed and decompressed in parallel.
+        // The chunk table is followed by a table with the compressed length of each chunk.
+        static constexpr uint32_t COMPRESSION_GZIP_CHUNKS = 2;
 
     private:
 #pragma pack(push, 1)
@@ -74,38 +79,8 @@ namespace OpenRCT2
             _mode = mode;
             if (mode == Mode::READING)
             {
-                _header = _stream->ReadValue<Header>();
-
-                _chunks.clear();
-                for (uint32_t i = 0; i < _header.NumChunks; i++)
-                {
-                    auto entry = _stream->ReadValue<ChunkEntry>();
-                    _chunks.push_back(entry);
-                }
-
-                // Read compressed data into buffer (read in blocks)
-                _buffer = MemoryStream{};
-                uint8_t temp[2048];
-                uint64_t bytesLeft = _header.CompressedSize;
-                do
-                {
-                    auto readLen = std::min(size_t(bytesLeft), sizeof(temp));
-                    _stream->Read(temp, readLen);
-                    _buffer.Write(temp, readLen);
-                    bytesLeft -= readLen;
-                } while (bytesLeft > 0);
-
-                // Uncompress
-                if (_header.Compression == COMPRESSION_GZIP)
-                {
-                    auto uncompressedData = Ungzip(_buffer.GetData(), _buffer.GetLength());
-                    if (_header.UncompressedSize != uncompressedData.size())
-                    {
-                        // Warning?
-                    }
-                    _buffer.Clear();
-                    _buffer.Write(uncompressedData.data(), uncompressedData.size());
-                }
+                auto compressedLengths = ReadHeader();
+                ReadAllChunks(compressedLengths);
             }
             else
             {
@@ -116,11 +91,62 @@ namespace OpenRCT2
             }
         }
 
+        // Creates a stream for reading that only holds the specified chunks. When chunks are compressed
+        // independently the others are skipped without being read, otherwise the whole file is read.
+        OrcaStream(IStream& stream, const std::vector<uint32_t>& chunkIds)
+        {
+            _stream = &stream;
+            _mode = Mode::READING;
+
+            auto compressedLengths = ReadHeader();
+            if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+            {
+                ReadSelectedChunks(compressedLengths, chunkIds);
+            }
+            else
+            {
+                ReadAllChunks(compressedLengths);
+            }
+        }
+
+        // Creates a stream for writing that is not backed by a target stream, the written file has to be
+        // taken out with TakePendingWrite.
+        OrcaStream()
+        {
+            _stream = nullptr;
+            _mode = Mode::WRITING;
+            _header = {};
+            _header.Compression = COMPRESSION_GZIP;
+        }
+
         OrcaStream(const OrcaStream&) = delete;
 
         ~OrcaStream()
         {
-            if (_mode == Mode::WRITING)
+            if (_mode == Mode::WRITING && _stream != nullptr)
+            {
+                PendingWrite(_header, std::move(_chunks), std::move(_buffer)).Write(*_stream);
+            }
+        }
+
+        // All chunks written to a stream, ready to be compressed and written out. Writing does not touch
+        // any game state, so it can be done on another thread.
+        class PendingWrite
+        {
+        private:
+            Header _header;
+            std::vector<ChunkEntry> _chunks;
+            MemoryStream _buffer;
+
+        public:
+            PendingWrite(const Header& header, std::vector<ChunkEntry>&& chunks, MemoryStream&& buffer)
+                : _header(header)
+                , _chunks(std::move(chunks))
+                , _buffer(std::move(buffer))
+            {
+            }
+
+            void Write(IStream& stream)
             {
                 const void* uncompressedData = _buffer.GetData();
                 const uint64_t uncompressedSize = _buffer.GetLength();
@@ -132,7 +158,21 @@ namespace OpenRCT2
 
                 // Compress data
                 std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == COMPRESSION_GZIP)
+                std::vector<uint64_t> compressedLengths;
+                if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+                {
+                    compressedBytes = GzipChunks(_chunks, _buffer, compressedLengths);
+                    if (compressedBytes)
+                    {
+                        _header.CompressedSize = compressedBytes->size();
+                    }
+                    else
+                    {
+                        // Compression failed
+                        _header.Compression = COMPRESSION_NONE;
+                    }
+                }
+                else if (_header.Compression == COMPRESSION_GZIP)
                 {
                     compressedBytes = Gzip(uncompressedData, uncompressedSize);
                     if (compressedBytes)
@@ -147,22 +187,36 @@ namespace OpenRCT2
                 }
 
                 // Write header and chunk table
-                _stream->WriteValue(_header);
+                stream.WriteValue(_header);
                 for (const auto& chunk : _chunks)
                 {
-                    _stream->WriteValue(chunk);
+                    stream.WriteValue(chunk);
+                }
+                if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+                {
+                    for (const auto compressedLength : compressedLengths)
+                    {
+                        stream.WriteValue(compressedLength);
+                    }
                 }
 
                 // Write chunk data
                 if (compressedBytes)
                 {
-                    _stream->Write(compressedBytes->data(), compressedBytes->size());
+                    stream.Write(compressedBytes->data(), compressedBytes->size());
                 }
                 else
                 {
-                    _stream->Write(uncompressedData, uncompressedSize);
+                    stream.Write(uncompressedData, uncompressedSize);
                 }
             }
+        };
+
+        // Takes the written chunks out of the stream, nothing is written to the target stream afterwards.
+        PendingWrite TakePendingWrite()
+        {
+            _stream = nullptr;
+            return PendingWrite(_header, std::move(_chunks), std::move(_buffer));
         }
 
         Mode GetMode() const
@@ -205,6 +259,241 @@ namespace OpenRCT2
         }
 
     private:
+        // Reads the header and chunk table, returns the compressed length of each chunk if they are
+        // compressed independently.
+        std::vector<uint64_t> ReadHeader()
+        {
+            _header = _stream->ReadValue<Header>();
+
+            _chunks.clear();
+            for (uint32_t i = 0; i < _header.NumChunks; i++)
+            {
+                auto entry = _stream->ReadValue<ChunkEntry>();
+                _chunks.push_back(entry);
+            }
+
+            std::vector<uint64_t> compressedLengths;
+            if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+            {
+                for (uint32_t i = 0; i < _header.NumChunks; i++)
+                {
+                    compressedLengths.push_back(_stream->ReadValue<uint64_t>());
+                }
+            }
+            return compressedLengths;
+        }
+
+        void ReadAllChunks(const std::vector<uint64_t>& compressedLengths)
+        {
+            // Read compressed data into buffer (read in blocks)
+            _buffer = MemoryStream{};
+            uint8_t temp[2048];
+            uint64_t bytesLeft = _header.CompressedSize;
+            do
+            {
+                auto readLen = std::min(size_t(bytesLeft), sizeof(temp));
+                _stream->Read(temp, readLen);
+                _buffer.Write(temp, readLen);
+                bytesLeft -= readLen;
+            } while (bytesLeft > 0);
+
+            // Uncompress
+            if (_header.Compression == COMPRESSION_GZIP)
+            {
+                auto uncompressedData = Ungzip(_buffer.GetData(), _buffer.GetLength());
+                if (_header.UncompressedSize != uncompressedData.size())
+                {
+                    // Warning?
+                }
+                _buffer.Clear();
+                _buffer.Write(uncompressedData.data(), uncompressedData.size());
+            }
+            else if (_header.Compression == COMPRESSION_GZIP_CHUNKS)
+            {
+                auto uncompressedData = UngzipChunks(_header, _chunks, compressedLengths, _buffer);
+                _buffer.Clear();
+                _buffer.Write(uncompressedData.data(), uncompressedData.size());
+            }
+        }
+
+        // Seeks to and decompresses only the specified chunks, the chunk table is reduced to them.
+        void ReadSelectedChunks(const std::vector<uint64_t>& compressedLengths, const std::vector<uint32_t>& chunkIds)
+        {
+            const auto dataStart = _stream->GetPosition();
+            const auto streamLength = _stream->GetLength();
+            if (dataStart > streamLength || _header.CompressedSize > streamLength - dataStart)
+            {
+                throw std::runtime_error("Chunk exceeds the size of the file");
+            }
+            const auto compressedOffsets = ValidateChunks(_header, _chunks, compressedLengths, _header.CompressedSize);
+
+            std::vector<ChunkEntry> selectedChunks;
+            _buffer = MemoryStream{};
+
+            for (size_t i = 0; i < _chunks.size(); i++)
+            {
+                auto chunk = _chunks[i];
+                if (std::find(chunkIds.begin(), chunkIds.end(), chunk.Id) != chunkIds.end())
+                {
+                    std::vector<uint8_t> compressedChunk(static_cast<size_t>(compressedLengths[i]));
+                    _stream->SetPosition(dataStart + compressedOffsets[i]);
+                    _stream->Read(compressedChunk.data(), compressedChunk.size());
+
+                    auto uncompressedChunk = Ungzip(compressedChunk.data(), compressedChunk.size());
+                    if (uncompressedChunk.size() != chunk.Length)
+                    {
+                        throw std::runtime_error("Failed to decompress chunk");
+                    }
+
+                    chunk.Offset = _buffer.GetPosition();
+                    _buffer.Write(uncompressedChunk.data(), uncompressedChunk.size());
+                    selectedChunks.push_back(chunk);
+                }
+            }
+            _chunks = std::move(selectedChunks);
+        }
+
+        // Compresses every chunk on its own using all cores, returns the compressed chunks back to back.
+        static std::optional<std::vector<uint8_t>> GzipChunks(
+            const std::vector<ChunkEntry>& chunks, const MemoryStream& buffer, std::vector<uint64_t>& compressedLengths)
+        {
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            std::vector<std::vector<uint8_t>> compressedChunks(chunks.size());
+            std::atomic<bool> failed{ false };
+
+            JobPool jobPool;
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                jobPool.AddTask([&, i]() {
+                    try
+                    {
+                        compressedChunks[i] = Gzip(data + chunks[i].Offset, static_cast<size_t>(chunks[i].Length));
+                    }
+                    catch (const std::exception&)
+                    {
+                        failed = true;
+                    }
+                });
+            }
+            jobPool.Join();
+
+            if (failed)
+            {
+                return std::nullopt;
+            }
+
+            std::vector<uint8_t> result;
+            compressedLengths.clear();
+            for (const auto& compressedChunk : compressedChunks)
+            {
+                compressedLengths.push_back(compressedChunk.size());
+                result.insert(result.end(), compressedChunk.begin(), compressedChunk.end());
+            }
+            return result;
+        }
+
+        // Checks that every chunk lies within the uncompressed data without overlapping another chunk, that
+        // the chunks make up all of the uncompressed data, and that the compressed chunks fit in the compressed
+        // data. Returns the offset of each compressed chunk.
+        static std::vector<uint64_t> ValidateChunks(
+            const Header& header, const std::vector<ChunkEntry>& chunks, const std::vector<uint64_t>& compressedLengths,
+            const uint64_t compressedSize)
+        {
+            // Deflate can not shrink data by more than this ratio, larger chunks can only come from a broken header.
+            constexpr uint64_t kMaxDeflateRatio = 1032;
+
+            if (compressedLengths.size() != chunks.size())
+            {
+                throw std::runtime_error("Chunk table is incomplete");
+            }
+
+            std::vector<uint64_t> compressedOffsets(chunks.size());
+            uint64_t compressedOffset = 0;
+            uint64_t totalLength = 0;
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                if (chunks[i].Length > header.UncompressedSize
+                    || chunks[i].Offset > header.UncompressedSize - chunks[i].Length
+                    || compressedLengths[i] > compressedSize - compressedOffset)
+                {
+                    throw std::runtime_error("Chunk exceeds the size of the file");
+                }
+                if (chunks[i].Length / kMaxDeflateRatio > compressedLengths[i])
+                {
+                    throw std::runtime_error("Chunk is larger than its compressed data allows");
+                }
+                if (chunks[i].Length > header.UncompressedSize - totalLength)
+                {
+                    throw std::runtime_error("Chunk sizes do not match the size of the file");
+                }
+                compressedOffsets[i] = compressedOffset;
+                compressedOffset += compressedLengths[i];
+                totalLength += chunks[i].Length;
+            }
+            if (totalLength != header.UncompressedSize)
+            {
+                throw std::runtime_error("Chunk sizes do not match the size of the file");
+            }
+
+            std::vector<const ChunkEntry*> sortedChunks;
+            sortedChunks.reserve(chunks.size());
+            for (const auto& chunk : chunks)
+            {
+                sortedChunks.push_back(&chunk);
+            }
+            std::sort(sortedChunks.begin(), sortedChunks.end(), [](const ChunkEntry* a, const ChunkEntry* b) {
+                return a->Offset < b->Offset;
+            });
+            for (size_t i = 1; i < sortedChunks.size(); i++)
+            {
+                if (sortedChunks[i]->Offset < sortedChunks[i - 1]->Offset + sortedChunks[i - 1]->Length)
+                {
+                    throw std::runtime_error("Chunks overlap");
+                }
+            }
+            return compressedOffsets;
+        }
+
+        // Decompresses every chunk on its own using all cores, returns the uncompressed data.
+        static std::vector<uint8_t> UngzipChunks(
+            const Header& header, const std::vector<ChunkEntry>& chunks, const std::vector<uint64_t>& compressedLengths,
+            const MemoryStream& buffer)
+        {
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            const auto compressedOffsets = ValidateChunks(header, chunks, compressedLengths, buffer.GetLength());
+            std::vector<uint8_t> result(static_cast<size_t>(header.UncompressedSize));
+
+            std::atomic<bool> failed{ false };
+            JobPool jobPool;
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                jobPool.AddTask([&, i]() {
+                    try
+                    {
+                        auto uncompressedChunk = Ungzip(
+                            data + compressedOffsets[i], static_cast<size_t>(compressedLengths[i]));
+                        if (uncompressedChunk.size() != chunks[i].Length)
+                        {
+                            failed = true;
+                            return;
+                        }
+                        std::copy(uncompressedChunk.begin(), uncompressedChunk.end(), result.begin() + chunks[i].Offset);
+                    }
+                    catch (const std::exception&)
+                    {
+                        failed = true;
+                    }
+                });
+            }
+            jobPool.Join();
+
+            if (failed)
+            {
+                throw std::runtime_error("Failed to decompress chunk");
+            }
+            return result;
+        }
+
         bool SeekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
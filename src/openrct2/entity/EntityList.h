@@ -22,19 +22,19 @@ const std::list<EntityId>& GetEntityList(const EntityType id);
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
-const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
+// Entities on a tile are linked in EntityId order, the next id is null after the last entity.
+EntityId GetFirstEntityOnTile(const CoordsXY& spritePos);
+EntityId GetNextEntityOnTile(EntityId entityIndex);
 
 template<typename T> class EntityTileIterator
 {
 private:
-    std::vector<EntityId>::const_iterator iter;
-    std::vector<EntityId>::const_iterator end;
+    EntityId next;
     T* Entity = nullptr;
 
 public:
-    EntityTileIterator(std::vector<EntityId>::const_iterator _iter, std::vector<EntityId>::const_iterator _end)
-        : iter(_iter)
-        , end(_end)
+    EntityTileIterator(EntityId _first)
+        : next(_first)
     {
         ++(*this);
     }
@@ -42,9 +42,11 @@ public:
     {
         Entity = nullptr;
 
-        while (iter != end && Entity == nullptr)
+        while (!next.IsNull() && Entity == nullptr)
         {
-            Entity = GetEntity<T>(*iter++);
+            const auto current = next;
+            next = GetNextEntityOnTile(current);
+            Entity = GetEntity<T>(current);
         }
         return *this;
     }
@@ -53,7 +55,7 @@ public:
     {
         EntityTileIterator retval = *this;
         ++(*this);
-        return *iter;
+        return retval;
     }
     bool operator==(EntityTileIterator other) const
     {
@@ -78,21 +80,21 @@ public:
 template<typename T = EntityBase> class EntityTileList
 {
 private:
-    const std::vector<EntityId>& vec;
+    const EntityId first;
 
 public:
     EntityTileList(const CoordsXY& loc)
-        : vec(GetEntityTileList(loc))
+        : first(GetFirstEntityOnTile(loc))
     {
     }
 
     EntityTileIterator<T> begin()
     {
-        return EntityTileIterator<T>(std::begin(vec), std::end(vec));
+        return EntityTileIterator<T>(first);
     }
     EntityTileIterator<T> end()
     {
-        return EntityTileIterator<T>(std::end(vec), std::end(vec));
+        return EntityTileIterator<T>(EntityId::GetNull());
     }
 };
 
@@ -118,6 +120,12 @@ public:
         {
             Entity = GetEntity<T>(*iter++);
         }
+
+        // Load the next entity while the caller is busy with this one.
+        if (iter != end)
+        {
+            PrefetchEntity(*iter);
+        }
         return *this;
     }
 
@@ -17,6 +17,7 @@
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../core/MemoryStream.h"
 #include "../core/String.hpp"
 #include "../entity/Peep.h"
@@ -26,6 +27,7 @@
 #include "../profiling/Profiling.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
+#include "../util/Prefetch.h"
 #include "Balloon.h"
 #include "Duck.h"
 #include "EntityTweener.h"
@@ -33,10 +35,17 @@
 #include "MoneyEffect.h"
 #include "Particle.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <deque>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -46,10 +55,26 @@ static std::vector<EntityId> _freeIdList;
 
 static bool _entityFlashingList[MAX_ENTITIES];
 
+// Incremented every time a slot is handed out, so that an id and generation pair uniquely identifies an entity.
+static std::array<uint16_t, MAX_ENTITIES> _entityGenerations;
+
+// Enough for every entity slot to be removed and reused once between two drains.
+static constexpr size_t kMaxEntityLifecycleEvents = MAX_ENTITIES * 2;
+static bool _entityLifecycleEnabled = false;
+static bool _entityLifecycleOverflowed = false;
+static std::deque<EntityLifecycleEvent> _entityLifecycleEvents;
+
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical) + 1;
 constexpr uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
-static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
+// Entities on the same tile form a doubly linked list in EntityId order, threaded through side arrays
+// indexed by EntityId. The previous link of the first entity on a tile points at the last one, so
+// inserting at the end of a tile does not need to walk the list.
+static std::vector<EntityId> _spatialHeads;
+static std::vector<EntityId> _spatialNext;
+static std::vector<EntityId> _spatialPrev;
+static std::vector<uint32_t> _spatialTiles;
+constexpr uint32_t SPATIAL_INDEX_NOT_INDEXED = std::numeric_limits<uint32_t>::max();
 
 static void FreeEntity(EntityBase& entity);
 
@@ -102,6 +127,9 @@ std::string EntitiesChecksum::ToString() const
     return String::StringFromHex(raw);
 }
 
+// Typical cache line size, entity slots span several of them.
+static constexpr size_t kEntityPrefetchStride = 64;
+
 EntityBase* TryGetEntity(EntityId entityIndex)
 {
     auto& gameState = GetGameState();
@@ -119,9 +147,30 @@ EntityBase* GetEntity(EntityId entityIndex)
     return TryGetEntity(entityIndex);
 }
 
-const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
+void PrefetchEntity(EntityId entityIndex)
+{
+    const auto idx = entityIndex.ToUnderlying();
+    if (idx >= MAX_ENTITIES)
+        return;
+
+    const auto* slot = reinterpret_cast<const std::byte*>(&GetGameState().Entities[idx]);
+    for (size_t offset = 0; offset < sizeof(Entity_t); offset += kEntityPrefetchStride)
+    {
+        PREFETCH(slot + offset);
+    }
+}
+
+EntityId GetFirstEntityOnTile(const CoordsXY& spritePos)
+{
+    if (_spatialHeads.empty())
+        return EntityId::GetNull();
+
+    return _spatialHeads[GetSpatialIndexOffset(spritePos)];
+}
+
+EntityId GetNextEntityOnTile(EntityId entityIndex)
 {
-    return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
+    return _spatialNext[entityIndex.ToUnderlying()];
 }
 
 static void ResetEntityLists()
@@ -186,10 +235,20 @@ void ResetAllEntities()
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
+    _entityLifecycleEvents.clear();
+    _entityLifecycleOverflowed = _entityLifecycleEnabled;
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
 
+static void ClearEntitySpatialIndex()
+{
+    _spatialHeads.assign(SPATIAL_INDEX_SIZE, EntityId::GetNull());
+    _spatialNext.assign(MAX_ENTITIES, EntityId::GetNull());
+    _spatialPrev.assign(MAX_ENTITIES, EntityId::GetNull());
+    _spatialTiles.assign(MAX_ENTITIES, SPATIAL_INDEX_NOT_INDEXED);
+}
+
 /**
  *
  *  rct2: 0x0069EBE4
@@ -198,10 +257,7 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
  */
 void ResetEntitySpatialIndices()
 {
-    for (auto& vec : gEntitySpatialIndex)
-    {
-        vec.clear();
-    }
+    ClearEntitySpatialIndex();
     for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
     {
         auto* spr = GetEntity(EntityId::FromUnderlying(i));
@@ -237,6 +293,121 @@ EntitiesChecksum GetAllEntitiesChecksum()
 
     return checksum;
 }
+
+template<typename T> static void CollectNetworkEntities(std::vector<EntityBase*>& entities)
+{
+    for (auto* ent : EntityList<T>())
+    {
+        entities.push_back(ent);
+    }
+}
+
+// Serialises the entity through the Serialise of its concrete type, as GetAllEntitiesChecksum does.
+static void NetworkSerialiseEntity(EntityBase* entity, DataSerialiser& ds)
+{
+    switch (entity->Type)
+    {
+        case EntityType::Guest:
+            entity->As<Guest>()->Serialise(ds);
+            break;
+        case EntityType::Staff:
+            entity->As<Staff>()->Serialise(ds);
+            break;
+        case EntityType::Vehicle:
+            entity->As<Vehicle>()->Serialise(ds);
+            break;
+        case EntityType::Litter:
+            entity->As<Litter>()->Serialise(ds);
+            break;
+        default:
+            entity->Serialise(ds);
+            break;
+    }
+}
+
+// Sums the hashes of the entities in the range, each entity is hashed on its own.
+static uint64_t SumEntityHashes(EntityBase* const* begin, EntityBase* const* end)
+{
+    uint64_t sum = 0;
+    for (auto it = begin; it != end; it++)
+    {
+        std::array<std::byte, 20> raw{};
+        OpenRCT2::ChecksumStream ms(raw);
+        DataSerialiser ds(true, ms);
+        NetworkSerialiseEntity(*it, ds);
+
+        uint64_t hash;
+        std::memcpy(&hash, raw.data(), sizeof(hash));
+        sum += hash;
+    }
+    return sum;
+}
+
+static constexpr size_t kEntityChecksumBatchSize = 1024;
+static std::unique_ptr<JobPool> _entityChecksumJobs;
+
+#ifdef DEBUG
+// Checks that hashing the entities one by one covers exactly the bytes GetAllEntitiesChecksum hashes.
+static bool EntityHashesMatchSerialiser(const std::vector<EntityBase*>& entities)
+{
+    OpenRCT2::MemoryStream full;
+    DataSerialiser fullDs(true, full);
+    NetworkSerialiseEntityTypes<Guest, Staff, Vehicle, Litter>(fullDs);
+
+    OpenRCT2::MemoryStream perEntity;
+    DataSerialiser perEntityDs(true, perEntity);
+    for (auto* entity : entities)
+    {
+        NetworkSerialiseEntity(entity, perEntityDs);
+    }
+
+    return full.GetLength() == perEntity.GetLength()
+        && std::memcmp(full.GetData(), perEntity.GetData(), static_cast<size_t>(full.GetLength())) == 0;
+}
+#endif
+
+EntitiesChecksum GetAllEntitiesChecksumUnordered()
+{
+    PROFILED_FUNCTION();
+
+    std::vector<EntityBase*> entities;
+    CollectNetworkEntities<Guest>(entities);
+    CollectNetworkEntities<Staff>(entities);
+    CollectNetworkEntities<Vehicle>(entities);
+    CollectNetworkEntities<Litter>(entities);
+
+    // Addition is commutative, so the batches may finish in any order without affecting the result.
+    std::atomic<uint64_t> sum = 0;
+    if (entities.size() <= kEntityChecksumBatchSize)
+    {
+        sum = SumEntityHashes(entities.data(), entities.data() + entities.size());
+    }
+    else
+    {
+        if (_entityChecksumJobs == nullptr)
+        {
+            _entityChecksumJobs = std::make_unique<JobPool>();
+        }
+        for (size_t start = 0; start < entities.size(); start += kEntityChecksumBatchSize)
+        {
+            auto* const* begin = entities.data() + start;
+            auto* const* end = entities.data() + std::min(start + kEntityChecksumBatchSize, entities.size());
+            _entityChecksumJobs->AddTask(
+                [begin, end, &sum]() { sum.fetch_add(SumEntityHashes(begin, end), std::memory_order_relaxed); });
+        }
+        _entityChecksumJobs->Join();
+    }
+
+#ifdef DEBUG
+    Guard::Assert(
+        EntityHashesMatchSerialiser(entities), "Entity checksum does not cover the same data as GetAllEntitiesChecksum");
+#endif
+
+    EntitiesChecksum checksum{};
+    const uint64_t result = sum.load();
+    std::memcpy(checksum.raw.data(), &result, sizeof(result));
+    return checksum;
+}
 #else
 
 EntitiesChecksum GetAllEntitiesChecksum()
@@ -244,6 +415,11 @@ EntitiesChecksum GetAllEntitiesChecksum()
     return EntitiesChecksum{};
 }
 
+EntitiesChecksum GetAllEntitiesChecksumUnordered()
+{
+    return EntitiesChecksum{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void EntityReset(EntityBase* entity)
@@ -296,11 +472,25 @@ uint16_t GetMiscEntityCount()
     return count;
 }
 
+static void RecordLifecycleEvent(const EntityBase* entity, bool removed)
+{
+    if (!_entityLifecycleEnabled)
+        return;
+
+    if (_entityLifecycleEvents.size() >= kMaxEntityLifecycleEvents)
+    {
+        _entityLifecycleEvents.pop_front();
+        _entityLifecycleOverflowed = true;
+    }
+    _entityLifecycleEvents.push_back({ entity->Id, _entityGenerations[entity->Id.ToUnderlying()], entity->Type, removed });
+}
+
 static void PrepareNewEntity(EntityBase* base, const EntityType type)
 {
     // Need to reset all sprite data, as the uninitialised values
     // may contain garbage and cause a desync later on.
     EntityReset(base);
+    _entityGenerations[base->Id.ToUnderlying()]++;
 
     base->Type = type;
     AddToEntityList(base);
@@ -314,6 +504,7 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
     base->SpriteData.SpriteRect = {};
 
     EntitySpatialInsert(base, { kLocationNull, 0 });
+    RecordLifecycleEvent(base, false);
 }
 
 EntityBase* CreateEntity(EntityType type)
@@ -405,26 +596,87 @@ void UpdateMoneyEffect()
 // Performs a search to ensure that insert keeps next_in_quadrant in sprite_index order
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
 {
-    size_t newIndex = GetSpatialIndexOffset(newLoc);
-    auto& spatialVector = gEntitySpatialIndex[newIndex];
-    auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->Id);
-    spatialVector.insert(index, entity->Id);
+    if (_spatialHeads.empty())
+    {
+        ClearEntitySpatialIndex();
+    }
+
+    const auto id = entity->Id;
+    const auto tile = static_cast<uint32_t>(GetSpatialIndexOffset(newLoc));
+    _spatialTiles[id.ToUnderlying()] = tile;
+
+    auto& head = _spatialHeads[tile];
+    if (head.IsNull())
+    {
+        head = id;
+        _spatialNext[id.ToUnderlying()] = EntityId::GetNull();
+        _spatialPrev[id.ToUnderlying()] = id;
+        return;
+    }
+
+    // Find the first entity with a higher id, most entities are appended at the end of the tile.
+    auto tail = _spatialPrev[head.ToUnderlying()];
+    if (tail.ToUnderlying() < id.ToUnderlying())
+    {
+        _spatialNext[tail.ToUnderlying()] = id;
+        _spatialPrev[id.ToUnderlying()] = tail;
+        _spatialNext[id.ToUnderlying()] = EntityId::GetNull();
+        _spatialPrev[head.ToUnderlying()] = id;
+        return;
+    }
+
+    auto next = head;
+    while (next.ToUnderlying() < id.ToUnderlying())
+    {
+        next = _spatialNext[next.ToUnderlying()];
+    }
+
+    _spatialNext[id.ToUnderlying()] = next;
+    if (next == head)
+    {
+        _spatialPrev[id.ToUnderlying()] = tail;
+        head = id;
+    }
+    else
+    {
+        const auto prev = _spatialPrev[next.ToUnderlying()];
+        _spatialPrev[id.ToUnderlying()] = prev;
+        _spatialNext[prev.ToUnderlying()] = id;
+    }
+    _spatialPrev[next.ToUnderlying()] = id;
 }
 
 static void EntitySpatialRemove(EntityBase* entity)
 {
-    size_t currentIndex = GetSpatialIndexOffset({ entity->x, entity->y });
-    auto& spatialVector = gEntitySpatialIndex[currentIndex];
-    auto index = BinaryFind(std::begin(spatialVector), std::end(spatialVector), entity->Id);
-    if (index != std::end(spatialVector))
+    const auto id = entity->Id;
+    const auto tile = static_cast<uint32_t>(GetSpatialIndexOffset({ entity->x, entity->y }));
+    if (_spatialHeads.empty() || _spatialTiles[id.ToUnderlying()] != tile)
     {
-        spatialVector.erase(index, index + 1);
+        LOG_WARNING("Bad sprite spatial index. Rebuilding the spatial index...");
+        ResetEntitySpatialIndices();
+        return;
+    }
+
+    auto& head = _spatialHeads[tile];
+    const auto next = _spatialNext[id.ToUnderlying()];
+    const auto prev = _spatialPrev[id.ToUnderlying()];
+    if (head == id)
+    {
+        head = next;
+        if (!next.IsNull())
+        {
+            _spatialPrev[next.ToUnderlying()] = prev;
+        }
     }
     else
     {
-        LOG_WARNING("Bad sprite spatial index. Rebuilding the spatial index...");
-        ResetEntitySpatialIndices();
+        _spatialNext[prev.ToUnderlying()] = next;
+        _spatialPrev[next.IsNull() ? head.ToUnderlying() : next.ToUnderlying()] = prev;
     }
+
+    _spatialNext[id.ToUnderlying()] = EntityId::GetNull();
+    _spatialPrev[id.ToUnderlying()] = EntityId::GetNull();
+    _spatialTiles[id.ToUnderlying()] = SPATIAL_INDEX_NOT_INDEXED;
 }
 
 static void EntitySpatialMove(EntityBase* entity, const CoordsXY& newLoc)
@@ -503,6 +755,7 @@ static void FreeEntity(EntityBase& entity)
  */
 void EntityRemove(EntityBase* entity)
 {
+    RecordLifecycleEvent(entity, true);
     FreeEntity(*entity);
 
     EntityTweener::Get().RemoveEntity(entity);
@@ -541,6 +794,32 @@ uint16_t RemoveFloatingEntities()
     return removed;
 }
 
+uint16_t GetEntityGeneration(EntityId entityIndex)
+{
+    const auto idx = entityIndex.ToUnderlying();
+    return idx >= MAX_ENTITIES ? 0 : _entityGenerations[idx];
+}
+
+void EntityLifecycleSetEnabled(bool enabled)
+{
+    _entityLifecycleEnabled = enabled;
+    _entityLifecycleOverflowed = false;
+    _entityLifecycleEvents.clear();
+}
+
+size_t EntityLifecycleDrain(EntityLifecycleEvent* buffer, size_t capacity)
+{
+    auto count = std::min(capacity, _entityLifecycleEvents.size());
+    std::copy_n(_entityLifecycleEvents.begin(), count, buffer);
+    _entityLifecycleEvents.erase(_entityLifecycleEvents.begin(), _entityLifecycleEvents.begin() + count);
+    return count;
+}
+
+bool EntityLifecycleTakeOverflow()
+{
+    return std::exchange(_entityLifecycleOverflowed, false);
+}
+
 void EntitySetFlashing(EntityBase* entity, bool flashing)
 {
     assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
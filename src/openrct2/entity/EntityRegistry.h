@@ -44,6 +44,11 @@ template<typename T> T* TryGetEntity(EntityId sprite_idx)
     return spr != nullptr ? spr->As<T>() : nullptr;
 }
 
+// Hints the CPU to start loading the storage of the entity, so that it is in cache by the time the
+// entity is used. Entity slots are large and spread out, so walking entity lists otherwise stalls on
+// every entity.
+void PrefetchEntity(EntityId entityIndex);
+
 EntityBase* CreateEntity(EntityType type);
 
 template<typename T> T* CreateEntity()
@@ -77,5 +82,28 @@ struct EntitiesChecksum
 #pragma pack(pop)
 EntitiesChecksum GetAllEntitiesChecksum();
 
+// Checksum of the same entities as GetAllEntitiesChecksum, but taken as the sum of a hash per entity.
+// The result does not depend on the order the entities are hashed in, which allows spreading the
+// work over multiple threads. Used for network synchronisation, replays keep the ordered checksum.
+EntitiesChecksum GetAllEntitiesChecksumUnordered();
+
+// Returns how many times the slot of the entity id has been (re)used, to detect stale ids.
+uint16_t GetEntityGeneration(EntityId entityIndex);
+
+struct EntityLifecycleEvent
+{
+    EntityId Id;
+    uint16_t Generation;
+    EntityType Type;
+    bool Removed;
+};
+
+// Records every created and removed entity in order, for hosts that mirror the entity lists.
+// Disabled by default; once enabled the events have to be drained regularly. When the host falls
+// too far behind the oldest events are dropped, and the overflow flag tells it to rebuild its mirror.
+void EntityLifecycleSetEnabled(bool enabled);
+size_t EntityLifecycleDrain(EntityLifecycleEvent* buffer, size_t capacity);
+bool EntityLifecycleTakeOverflow();
+
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
@@ -39,6 +39,7 @@
 #include "../peep/PeepAnimationData.h"
 #include "../peep/PeepThoughts.h"
 #include "../peep/RideUseSystem.h"
+#include "../profiling/Profiling.h"
 #include "../rct2/RCT2.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -901,6 +902,8 @@ void Guest::UpdateConsumptionMotives()
 
 void Guest::Tick128UpdateGuest(uint32_t index)
 {
+    PROFILED_FUNCTION();
+
     const auto currentTicks = GetGameState().CurrentTicks;
     if ((index & 0x1FF) != (currentTicks & 0x1FF))
     {
@@ -205,6 +205,8 @@ void PeepUpdateAll()
     constexpr auto kTicks128Mask = 128u - 1u;
     const auto currentTicksMasked = currentTicks & kTicks128Mask;
 
+    // The index is the position in the entity list rather than the entity id, so the periodic
+    // update buckets differ in size by at most one peep regardless of which ids are in use.
     uint32_t index = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
@@ -49,7 +49,7 @@ using namespace OpenRCT2;
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-constexpr uint8_t kNetworkStreamVersion = 5;
+constexpr uint8_t kNetworkStreamVersion = 6;
 
 const std::string kNetworkStreamID = std::string(OPENRCT2_VERSION) + "-" + std::to_string(kNetworkStreamVersion);
 
@@ -822,7 +822,7 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
+        EntitiesChecksum checksum = GetAllEntitiesChecksumUnordered();
         std::string clientSpriteHash = checksum.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
@@ -1592,7 +1592,7 @@ void NetworkBase::ServerSendTick()
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
+        EntitiesChecksum checksum = GetAllEntitiesChecksumUnordered();
         packet.WriteString(checksum.ToString());
     }
 
@@ -197,14 +197,14 @@ public:
     {
         ClearItems();
         auto items = _fileIndex.LoadOrBuild(language);
-        AddItems(items);
+        AddItems(std::move(items));
         SortItems();
     }
 
     void Construct(int32_t language) override
     {
         auto items = _fileIndex.Rebuild(language);
-        AddItems(items);
+        AddItems(std::move(items));
         SortItems();
     }
 
@@ -387,12 +387,14 @@ private:
         }
     }
 
-    void AddItems(const std::vector<ObjectRepositoryItem>& items)
+    void AddItems(std::vector<ObjectRepositoryItem>&& items)
     {
+        _items.reserve(_items.size() + items.size());
+
         size_t numConflicts = 0;
-        for (const auto& item : items)
+        for (auto& item : items)
         {
-            if (!AddItem(item))
+            if (!AddItem(std::move(item)))
             {
                 numConflicts++;
             }
@@ -403,7 +405,7 @@ private:
         }
     }
 
-    bool AddItem(const ObjectRepositoryItem& item)
+    bool AddItem(ObjectRepositoryItem&& item)
     {
         const auto newIdent = MapToNewObjectIdentifier(item.Identifier);
         if (!newIdent.empty())
@@ -424,9 +426,6 @@ private:
         if (conflict == nullptr)
         {
             size_t index = _items.size();
-            auto copy = item;
-            copy.Id = index;
-            _items.push_back(std::move(copy));
             if (!item.Identifier.empty())
             {
                 _newItemMap[item.Identifier] = index;
@@ -435,6 +434,8 @@ private:
             {
                 _itemMap[item.ObjectEntry] = index;
             }
+            item.Id = index;
+            _items.push_back(std::move(item));
             return true;
         }
         // When there is a conflict between a DAT file and a JSON file, the JSON should take precedence.
@@ -442,14 +443,14 @@ private:
         {
             const auto id = conflict->Id;
             const auto oldPath = conflict->Path;
-            _items[id] = item;
-            _items[id].Id = id;
+            Console::Error::WriteLine("Object conflict: '%s' was overridden by '%s'", oldPath.c_str(), item.Path.c_str());
+
             if (!item.Identifier.empty())
             {
                 _newItemMap[item.Identifier] = id;
             }
-
-            Console::Error::WriteLine("Object conflict: '%s' was overridden by '%s'", oldPath.c_str(), item.Path.c_str());
+            item.Id = id;
+            _items[id] = std::move(item);
             return true;
         }
 
@@ -463,7 +464,7 @@ private:
         auto language = LocalisationService_GetCurrentLanguage();
         if (auto result = _fileIndex.Create(language, path); result.has_value())
         {
-            AddItem(result.value());
+            AddItem(std::move(result.value()));
         }
     }
 
@@ -61,6 +61,8 @@
 #include <cassert>
 #include <cstdint>
 #include <ctime>
+#include <functional>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -112,9 +114,10 @@ namespace OpenRCT2
         void ThrowIfIncompatibleVersion()
         {
             const auto& header = _os->GetHeader();
-            if (/*header.TargetVersion < PARK_FILE_MIN_SUPPORTED_VERSION || */ header.MinVersion > PARK_FILE_CURRENT_VERSION)
+            const auto minVersion = header.MinVersion & ~PARK_FILE_CHUNKED_COMPRESSION_FLAG;
+            if (/*header.TargetVersion < PARK_FILE_MIN_SUPPORTED_VERSION || */ minVersion > PARK_FILE_CURRENT_VERSION)
             {
-                throw UnsupportedVersionException(header.MinVersion, header.TargetVersion);
+                throw UnsupportedVersionException(minVersion, header.TargetVersion);
             }
         }
 
@@ -122,7 +125,7 @@ namespace OpenRCT2
         bool IsSemiCompatibleVersion(uint32_t& minVersion, uint32_t& targetVersion)
         {
             const auto& header = _os->GetHeader();
-            minVersion = header.MinVersion;
+            minVersion = header.MinVersion & ~PARK_FILE_CHUNKED_COMPRESSION_FLAG;
             targetVersion = header.TargetVersion;
             return targetVersion > PARK_FILE_CURRENT_VERSION;
         }
@@ -143,6 +146,15 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(*_os);
         }
 
+        // Only reads the scenario chunk, which is all ReadScenarioChunk needs. The park can not be imported
+        // afterwards.
+        void LoadScenarioDetails(const std::string_view path)
+        {
+            FileStream fs(path, FILE_MODE_OPEN);
+            _os = std::make_unique<OrcaStream>(fs, std::vector<uint32_t>{ ParkFileChunkType::SCENARIO });
+            ThrowIfIncompatibleVersion();
+        }
+
         void Import(GameState_t& gameState)
         {
             auto& os = *_os;
@@ -169,14 +181,41 @@ namespace OpenRCT2
             gameState.InitialCash = gameState.Cash;
         }
 
+        // Streams are sent to network clients and stored in replays, so they keep the regular format
+        // that every build can read.
         void Save(GameState_t& gameState, IStream& stream)
         {
             OrcaStream os(stream, OrcaStream::Mode::WRITING);
+            WriteChunks(gameState, os, false);
+        }
+
+        void Save(GameState_t& gameState, const std::string_view path)
+        {
+            FileStream fs(path, FILE_MODE_WRITE);
+            OrcaStream os(fs, OrcaStream::Mode::WRITING);
+            WriteChunks(gameState, os, true);
+        }
+
+        // Writes all chunks into memory, compressing and writing them out is left to the caller.
+        OrcaStream::PendingWrite SaveDeferred(GameState_t& gameState)
+        {
+            OrcaStream os;
+            WriteChunks(gameState, os, true);
+            return os.TakePendingWrite();
+        }
 
+    private:
+        void WriteChunks(GameState_t& gameState, OrcaStream& os, bool compressChunks)
+        {
             auto& header = os.GetHeader();
             header.Magic = PARK_FILE_MAGIC;
             header.TargetVersion = PARK_FILE_CURRENT_VERSION;
             header.MinVersion = PARK_FILE_MIN_VERSION;
+            if (compressChunks)
+            {
+                header.MinVersion |= PARK_FILE_CHUNKED_COMPRESSION_FLAG;
+                header.Compression = OrcaStream::COMPRESSION_GZIP_CHUNKS;
+            }
 
             ReadWriteAuthoringChunk(os);
             ReadWriteObjectsChunk(os);
@@ -197,12 +236,7 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(os);
         }
 
-        void Save(GameState_t& gameState, const std::string_view path)
-        {
-            FileStream fs(path, FILE_MODE_WRITE);
-            Save(gameState, fs);
-        }
-
+    public:
         ScenarioIndexEntry ReadScenarioChunk()
         {
             ScenarioIndexEntry entry{};
@@ -2585,7 +2619,7 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
-int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
+static std::unique_ptr<OpenRCT2::ParkFile> ScenarioSavePrepare(int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
     {
@@ -2604,16 +2638,22 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
 
     PrepareMapForSave();
 
-    bool result = false;
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+        parkFile->ExportObjectsList = objManager.GetPackableObjects();
+    }
+    parkFile->OmitTracklessRides = true;
+    return parkFile;
+}
+
+int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
+{
+    bool result = false;
+    auto parkFile = ScenarioSavePrepare(flags);
     try
     {
-        if (flags & S6_SAVE_FLAG_EXPORT)
-        {
-            auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
-            parkFile->ExportObjectsList = objManager.GetPackableObjects();
-        }
-        parkFile->OmitTracklessRides = true;
         if (flags & S6_SAVE_FLAG_SCENARIO)
         {
             // s6exporter->SaveScenario(path);
@@ -2644,6 +2684,33 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
     return result;
 }
 
+std::function<bool()> ScenarioSaveDeferred(GameState_t& gameState, u8string_view path, int32_t flags)
+{
+    auto parkFile = ScenarioSavePrepare(flags);
+    try
+    {
+        auto pendingWrite = std::make_shared<OrcaStream::PendingWrite>(parkFile->SaveDeferred(gameState));
+        return [pendingWrite, path = u8string(path)]() {
+            try
+            {
+                FileStream fs(path, FILE_MODE_WRITE);
+                pendingWrite->Write(fs);
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR(e.what());
+                return false;
+            }
+        };
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR(e.what());
+        return {};
+    }
+}
+
 class ParkFileImporter final : public IParkImporter
 {
 private:
@@ -2697,6 +2764,12 @@ public:
         GameFixSaveVars();
     }
 
+    void LoadDetails(const u8string& path) override
+    {
+        _parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        _parkFile->LoadScenarioDetails(path);
+    }
+
     bool GetDetails(ScenarioIndexEntry* dst) override
     {
         *dst = _parkFile->ReadScenarioChunk();
@@ -16,6 +16,11 @@ namespace OpenRCT2
     // The minimum version that is forwards compatible with the current version.
     constexpr uint32_t PARK_FILE_MIN_VERSION = 40;
 
+    // Set in the minimum version of saved files whose chunks are compressed independently. Builds
+    // without support read it as a version far beyond their own and refuse the file, instead of
+    // reading the compressed chunks as raw data. Network and replay streams never use it.
+    constexpr uint32_t PARK_FILE_CHUNKED_COMPRESSION_FLAG = 0x80000000;
+
     // The minimum version that is backwards compatible with the current version.
     // If this is increased beyond 0, uncomment the checks in ParkFile.cpp and Context.cpp!
     constexpr uint32_t PARK_FILE_MIN_SUPPORTED_VERSION = 0x0;
@@ -28,6 +28,8 @@
 #include <bitset>
 #include <cassert>
 #include <cstring>
+#include <unordered_map>
+#include <vector>
 
 namespace OpenRCT2::PathFinding
 {
@@ -56,8 +58,90 @@ namespace OpenRCT2::PathFinding
             TileCoordsXYZ location;
             Direction direction;
         } history[kMaxJunctions + 1];
+        // Thin junctions at which the peep's own PathfindHistory was consulted, if recording.
+        std::vector<TileCoordsXYZ>* historyChecks;
+        bool historyMatched;
     };
 
+    /* Results of the heuristic search per starting edge, shared between guests. Apart from the
+     * guest's PathfindHistory a guest search only depends on the key and the path network, so
+     * guests that start from the same junction towards the same goal can reuse a previous result
+     * as long as none of the junctions it passed through are in their history. The cache is
+     * cleared whenever the map may have changed. */
+    struct PathSearchKey
+    {
+        TileCoordsXYZ start;
+        TileCoordsXYZ goal;
+        Direction testEdge;
+        int8_t maxJunctions;
+        int32_t countTilesChecked;
+        bool ignoreForeignQueues;
+        RideId queueRideIndex;
+
+        bool operator==(const PathSearchKey& other) const
+        {
+            return start == other.start && goal == other.goal && testEdge == other.testEdge
+                && maxJunctions == other.maxJunctions && countTilesChecked == other.countTilesChecked
+                && ignoreForeignQueues == other.ignoreForeignQueues && queueRideIndex == other.queueRideIndex;
+        }
+    };
+
+    struct PathSearchKeyHash
+    {
+        size_t operator()(const PathSearchKey& key) const
+        {
+            size_t hash = std::hash<int32_t>()(key.start.x);
+            const auto combine = [&hash](size_t value) { hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+            combine(key.start.y);
+            combine(key.start.z);
+            combine(key.goal.x);
+            combine(key.goal.y);
+            combine(key.goal.z);
+            combine(key.testEdge);
+            combine(key.maxJunctions);
+            combine(key.countTilesChecked);
+            combine(key.ignoreForeignQueues);
+            combine(key.queueRideIndex.ToUnderlying());
+            return hash;
+        }
+    };
+
+    struct PathSearchResultEntry
+    {
+        uint16_t score;
+        uint8_t steps;
+        std::vector<TileCoordsXYZ> historyChecks;
+    };
+
+    static constexpr size_t kMaxCachedPathSearches = 8192;
+    static std::unordered_map<PathSearchKey, PathSearchResultEntry, PathSearchKeyHash> _pathSearchCache;
+
+    void ClearSearchCache()
+    {
+        if (!_pathSearchCache.empty())
+        {
+            _pathSearchCache.clear();
+        }
+    }
+
+    static const PathSearchResultEntry* FindCachedPathSearch(const PathSearchKey& key, const Peep& peep)
+    {
+        auto it = _pathSearchCache.find(key);
+        if (it == _pathSearchCache.end())
+            return nullptr;
+
+        // The peep's history would have changed the search if it contains any of the checked junctions.
+        for (const auto& pathfindHistory : peep.PathfindHistory)
+        {
+            for (const auto& loc : it->second.historyChecks)
+            {
+                if (pathfindHistory == loc)
+                    return nullptr;
+            }
+        }
+        return &it->second;
+    }
+
     static int32_t GuestSurfacePathFinding(Peep& peep);
 
     enum class PathSearchResult
@@ -1071,10 +1155,15 @@ namespace OpenRCT2::PathFinding
                     bool pathLoop = false;
                     /* Check the peep.PathfindHistory to see if this junction has
                      * already been visited by the peep while heading for this goal. */
+                    if (state.historyChecks != nullptr)
+                    {
+                        state.historyChecks->push_back(loc);
+                    }
                     for (auto& pathfindHistory : peep.PathfindHistory)
                     {
                         if (pathfindHistory == loc)
                         {
+                            state.historyMatched = true;
                             if (pathfindHistory.direction == 0)
                             {
                                 /* If all directions have already been tried while
@@ -1458,9 +1547,42 @@ namespace OpenRCT2::PathFinding
                 LogPathfinding(
                     &peep, "Pathfind searching in direction: %d from %d,%d,%d", testEdge, loc.x >> 5, loc.y >> 5, loc.z);
 
-                PeepPathfindHeuristicSearch(
-                    state, { loc.x, loc.y, height }, goal, peep, firstTileElement, inPatrolArea, 0, &score, testEdge,
-                    &endJunctions, endJunctionList, endDirectionList, &endXYZ, &endSteps);
+                // Staff searches also depend on their patrol area and orders, only guest searches are shared.
+                PathSearchKey searchKey{};
+                searchKey.start = { loc.x, loc.y, height };
+                searchKey.goal = goal;
+                searchKey.testEdge = testEdge;
+                searchKey.maxJunctions = state.maxJunctions;
+                searchKey.countTilesChecked = state.countTilesChecked;
+                searchKey.ignoreForeignQueues = ignoreForeignQueues;
+                searchKey.queueRideIndex = queueRideIndex;
+                const bool canCache = !peep.Is<Staff>();
+                const PathSearchResultEntry* cached = canCache ? FindCachedPathSearch(searchKey, peep) : nullptr;
+                if (cached != nullptr)
+                {
+                    score = cached->score;
+                    endSteps = cached->steps;
+                }
+                else
+                {
+                    std::vector<TileCoordsXYZ> historyChecks;
+                    state.historyChecks = canCache ? &historyChecks : nullptr;
+                    state.historyMatched = false;
+
+                    PeepPathfindHeuristicSearch(
+                        state, { loc.x, loc.y, height }, goal, peep, firstTileElement, inPatrolArea, 0, &score, testEdge,
+                        &endJunctions, endJunctionList, endDirectionList, &endXYZ, &endSteps);
+
+                    state.historyChecks = nullptr;
+                    if (canCache && !state.historyMatched)
+                    {
+                        if (_pathSearchCache.size() >= kMaxCachedPathSearches)
+                        {
+                            _pathSearchCache.clear();
+                        }
+                        _pathSearchCache[searchKey] = { score, endSteps, std::move(historyChecks) };
+                    }
+                }
 
                 if constexpr (kLogPathfinding)
                 {
@@ -31,4 +31,7 @@ namespace OpenRCT2::PathFinding
 
     int32_t GuestPathFindParkEntranceLeaving(Peep& peep, uint8_t edges);
 
+    // Forgets all shared path search results, has to be called whenever the path network may have changed.
+    void ClearSearchCache();
+
 }; // namespace OpenRCT2::PathFinding
@@ -84,6 +84,11 @@ struct ShelteredEights
 // would be currently 80, this is the worst case of sub-steps and may break out earlier.
 static constexpr size_t MaxRideRatingUpdateSubSteps = 20;
 
+// Amount of updates allowed per updating state in the track designer. Each step walks a single track
+// piece, so this lets rides of several thousand pieces finish in one tick while a state machine that
+// never settles still returns control; anything longer simply carries on in the next tick.
+static constexpr size_t MaxTrackDesignerRideRatingUpdateSubSteps = MaxRideRatingUpdateSubSteps * 1024;
+
 static void ride_ratings_update_state(RideRatingUpdateState& state);
 static void ride_ratings_update_state_0(RideRatingUpdateState& state);
 static void ride_ratings_update_state_1(RideRatingUpdateState& state);
@@ -192,9 +197,14 @@ void RideRatingsUpdateAll()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    // The track designer runs no network session or replay, so there the state machine is allowed
+    // to finish a ride within the tick it was picked up on instead of spreading it across ticks.
+    const size_t maxSubSteps = (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) ? MaxTrackDesignerRideRatingUpdateSubSteps
+                                                                             : MaxRideRatingUpdateSubSteps;
+
     for (auto& updateState : GetGameState().RideRatingUpdateStates)
     {
-        for (size_t i = 0; i < MaxRideRatingUpdateSubSteps; ++i)
+        for (size_t i = 0; i < maxSubSteps; ++i)
         {
             ride_ratings_update_state(updateState);
 
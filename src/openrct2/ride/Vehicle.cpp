@@ -474,88 +474,69 @@ static void InvokeVehicleCrashHook(const EntityId vehicleId, const std::string_v
 }
 #endif
 
-static bool vehicle_move_info_valid(
-    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
-{
-    uint16_t typeAndDirection = (type << 2) | (direction & 3);
+// Amount of track type and direction combinations each subposition table has entries for.
+static constexpr uint16_t kVehicleTrackSubpositionTableSizes[] = {
+    VehicleTrackSubpositionSizeDefault, // Default
+    692,                                // ChairliftGoingOut
+    404,                                // ChairliftGoingBack
+    404,                                // ChairliftEndBullwheel
+    404,                                // ChairliftStartBullwheel
+    208,                                // GoKartsLeftLane
+    208,                                // GoKartsRightLane
+    208,                                // GoKartsMovingToRightLane
+    208,                                // GoKartsMovingToLeftLane
+    824,                                // MiniGolfPathA9
+    824,                                // MiniGolfBallPathA10
+    824,                                // MiniGolfPathB11
+    824,                                // MiniGolfBallPathB12
+    824,                                // MiniGolfPathC13
+    824,                                // MiniGolfBallPathC14
+    868,                                // ReverserRCFrontBogie
+    868,                                // ReverserRCRearBogie
+};
+static_assert(std::size(kVehicleTrackSubpositionTableSizes) == EnumValue(VehicleTrackSubposition::Count));
 
-    if (trackSubposition >= VehicleTrackSubposition{ std::size(gTrackVehicleInfo) })
-    {
-        return false;
-    }
-    int32_t size = 0;
-    switch (trackSubposition)
-    {
-        case VehicleTrackSubposition::Default:
-            size = VehicleTrackSubpositionSizeDefault;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingOut:
-            size = 692;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingBack:
-        case VehicleTrackSubposition::ChairliftEndBullwheel:
-        case VehicleTrackSubposition::ChairliftStartBullwheel:
-            size = 404;
-            break;
-        case VehicleTrackSubposition::GoKartsLeftLane:
-        case VehicleTrackSubposition::GoKartsRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToLeftLane:
-            size = 208;
-            break;
-        case VehicleTrackSubposition::MiniGolfPathA9: // VehicleTrackSubposition::MiniGolfStart9
-        case VehicleTrackSubposition::MiniGolfBallPathA10:
-        case VehicleTrackSubposition::MiniGolfPathB11:
-        case VehicleTrackSubposition::MiniGolfBallPathB12:
-        case VehicleTrackSubposition::MiniGolfPathC13:
-        case VehicleTrackSubposition::MiniGolfBallPathC14:
-            size = 824;
-            break;
-        case VehicleTrackSubposition::ReverserRCFrontBogie:
-        case VehicleTrackSubposition::ReverserRCRearBogie:
-            size = 868;
-            break;
-        default:
-            break;
-    }
-    if (typeAndDirection >= size)
+static const VehicleInfoList* vehicle_get_move_info_list(
+    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction)
+{
+    const auto subposition = EnumValue(trackSubposition);
+    if (subposition >= std::size(kVehicleTrackSubpositionTableSizes))
     {
-        return false;
+        return nullptr;
     }
-    if (offset >= gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->size)
+
+    uint16_t typeAndDirection = (type << 2) | (direction & 3);
+    if (typeAndDirection >= kVehicleTrackSubpositionTableSizes[subposition])
     {
-        return false;
+        return nullptr;
     }
-    return true;
+    return gTrackVehicleInfo[subposition][typeAndDirection];
 }
 
-static const VehicleInfo* vehicle_get_move_info(
-    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
+static const VehicleInfo* vehicle_get_move_info(const VehicleInfoList* moveInfoList, int32_t offset)
 {
-    uint16_t typeAndDirection = (type << 2) | (direction & 3);
-
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, offset))
+    if (moveInfoList == nullptr || offset >= moveInfoList->size)
     {
         static constexpr VehicleInfo zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->info[offset];
+    return &moveInfoList->info[offset];
+}
+
+const VehicleInfoList* Vehicle::GetMoveInfoList() const
+{
+    return vehicle_get_move_info_list(TrackSubposition, GetTrackType(), GetTrackDirection());
 }
 
 const VehicleInfo* Vehicle::GetMoveInfo() const
 {
-    return vehicle_get_move_info(TrackSubposition, GetTrackType(), GetTrackDirection(), track_progress);
+    return vehicle_get_move_info(GetMoveInfoList(), track_progress);
 }
 
 uint16_t VehicleGetMoveInfoSize(VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction)
 {
-    uint16_t typeAndDirection = (type << 2) | (direction & 3);
-
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, 0))
-    {
-        return 0;
-    }
-    return gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->size;
+    const auto* moveInfoList = vehicle_get_move_info_list(trackSubposition, type, direction);
+    return moveInfoList != nullptr ? moveInfoList->size : 0;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -7158,8 +7139,10 @@ bool Vehicle::UpdateTrackMotionForwards(const CarEntry* carEntry, const Ride& cu
 
         uint16_t newTrackProgress = track_progress + 1;
 
-        // Track Total Progress is in the two bytes before the move info list
-        uint16_t trackTotalProgress = GetTrackProgress();
+        // The move info list is resolved once per step and only looked up again when the car
+        // moves onto the next track piece.
+        const auto* moveInfoList = GetMoveInfoList();
+        uint16_t trackTotalProgress = moveInfoList != nullptr ? moveInfoList->size : 0;
         if (newTrackProgress >= trackTotalProgress)
         {
             UpdateCrossings();
@@ -7172,13 +7155,14 @@ bool Vehicle::UpdateTrackMotionForwards(const CarEntry* carEntry, const Ride& cu
                 return false;
             }
             newTrackProgress = 0;
+            moveInfoList = GetMoveInfoList();
         }
 
         track_progress = newTrackProgress;
         UpdateHandleWaterSplash();
 
         // Loc6DB706
-        const auto moveInfo = GetMoveInfo();
+        const auto moveInfo = vehicle_get_move_info(moveInfoList, track_progress);
         trackType = GetTrackType();
         uint8_t moveInfovehicleAnimationGroup;
         {
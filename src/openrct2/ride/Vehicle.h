@@ -280,6 +280,7 @@ struct Vehicle : EntityBase
     friend void UpdateRotatingEnterprise(Vehicle& vehicle);
 
 private:
+    const VehicleInfoList* GetMoveInfoList() const;
     const VehicleInfo* GetMoveInfo() const;
     uint16_t GetTrackProgress() const;
     void CableLiftUpdate();
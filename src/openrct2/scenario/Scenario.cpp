@@ -253,6 +253,8 @@ static void ScenarioCheckEntranceFeeTooHigh()
 
 void ScenarioAutosaveCheck()
 {
+    GameAutosaveUpdate();
+
     if (gLastAutoSaveUpdate == kAutosavePause)
         return;
 
@@ -20,6 +20,8 @@
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 
+#include <functional>
+
 struct ResultWithMessage;
 
 using random_engine_t = OpenRCT2::Random::RCT2::Engine;
@@ -173,6 +175,9 @@ uint32_t ScenarioRandMax(uint32_t max);
 
 ResultWithMessage ScenarioPrepareForSave(OpenRCT2::GameState_t& gameState);
 int32_t ScenarioSave(OpenRCT2::GameState_t& gameState, u8string_view path, int32_t flags);
+// Serialises the park on the calling thread and returns the work left to compress and write it to the
+// specified path, which may run on any thread. Returns an empty function when serialising fails.
+std::function<bool()> ScenarioSaveDeferred(OpenRCT2::GameState_t& gameState, u8string_view path, int32_t flags);
 void ScenarioFailure(OpenRCT2::GameState_t& gameState);
 void ScenarioSuccess(OpenRCT2::GameState_t& gameState);
 void ScenarioSuccessSubmitName(OpenRCT2::GameState_t& gameState, const char* name);
@@ -217,7 +217,7 @@ private:
 
             if (importer)
             {
-                importer->LoadScenario(path, true);
+                importer->LoadDetails(path);
                 if (importer->GetDetails(entry))
                 {
                     entry->Path = path;
@@ -15,6 +15,7 @@
 #    include "../../../core/Guard.hpp"
 #    include "../../../entity/EntityRegistry.h"
 #    include "../../../object/LargeSceneryEntry.h"
+#    include "../../../peep/GuestPathfinding.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
 #    include "../../../world/Scenery.h"
@@ -125,6 +126,7 @@ namespace OpenRCT2::Scripting
                     first[numElements - 1].SetLastForTile(true);
                 }
             }
+            PathFinding::ClearSearchCache();
             MapInvalidateTileFull(_coords);
         }
     }
@@ -177,6 +179,7 @@ namespace OpenRCT2::Scripting
                     first[i].SetLastForTile(false);
                 }
                 first[origNumElements].SetLastForTile(true);
+                PathFinding::ClearSearchCache();
                 MapInvalidateTileFull(_coords);
                 result = std::make_shared<ScTileElement>(_coords, &first[index]);
             }
@@ -16,6 +16,7 @@
 #    include "../../../entity/EntityRegistry.h"
 #    include "../../../object/LargeSceneryEntry.h"
 #    include "../../../object/WallSceneryEntry.h"
+#    include "../../../peep/GuestPathfinding.h"
 #    include "../../../ride/Ride.h"
 #    include "../../../ride/RideData.h"
 #    include "../../../ride/Track.h"
@@ -2146,6 +2147,8 @@ namespace OpenRCT2::Scripting
 
     void ScTileElement::Invalidate()
     {
+        // Scripts edit elements in place, so no tile element insert or remove clears the cached searches
+        PathFinding::ClearSearchCache();
         MapInvalidateTileFull(_coords);
     }
 
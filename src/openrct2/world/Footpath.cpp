@@ -29,6 +29,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/PathAdditionEntry.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/GuestPathfinding.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -1346,6 +1347,12 @@ bool PathElement::IsWide() const
 
 void PathElement::SetWide(bool isWide)
 {
+    if (IsWide() == isWide)
+        return;
+
+    // Guests read the flag while searching for a path, so cached searches are no longer valid
+    PathFinding::ClearSearchCache();
+
     Type &= ~FOOTPATH_ELEMENT_TYPE_FLAG_IS_WIDE;
     if (isWide)
         Type |= FOOTPATH_ELEMENT_TYPE_FLAG_IS_WIDE;
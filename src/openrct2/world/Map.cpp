@@ -37,6 +37,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../peep/GuestPathfinding.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
@@ -52,6 +53,7 @@
 #include "Entrance.h"
 #include "Footpath.h"
 #include "MapAnimation.h"
+#include "MapChanges.h"
 #include "Park.h"
 #include "Scenery.h"
 #include "Surface.h"
@@ -154,6 +156,7 @@ void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElem
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
     _tileElementsInUse = gameState.TileElements.size();
+    PathFinding::ClearSearchCache();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -413,6 +416,8 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    MapChangesMarkTile(tilePos);
+    PathFinding::ClearSearchCache();
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
@@ -470,6 +475,7 @@ void MapInit(const TileCoordsXY& size)
     gameState.MapSize = size;
     MapRemoveOutOfRangeElements();
     ClearMapAnimations();
+    MapChangesClear();
 
     auto intent = Intent(INTENT_ACTION_MAP);
     ContextBroadcastIntent(&intent);
@@ -1023,6 +1029,8 @@ bool MapIsLocationAtEdge(const CoordsXY& loc)
  */
 void TileElementRemove(TileElement* tileElement)
 {
+    PathFinding::ClearSearchCache();
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1191,6 +1199,8 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    MapChangesMarkTile(tileLoc);
+    PathFinding::ClearSearchCache();
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1747,6 +1757,7 @@ static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t
  */
 void MapInvalidateTile(const CoordsXYRangedZ& tilePos)
 {
+    MapChangesMarkTile(tilePos);
     MapInvalidateTileUnderZoom(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, ZoomLevel{ -1 });
 }
 
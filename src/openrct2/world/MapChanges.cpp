@@ -0,0 +1,114 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MapChanges.h"
+
+#include "Map.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+static bool _mapChangesEnabled = false;
+static std::vector<bool> _mapChangedFlags;
+static std::deque<TileCoordsXY> _mapChangedTiles;
+
+static constexpr int32_t kMapChunkCount = (kMaximumMapSizeTechnical + kMapChangesChunkSize - 1) / kMapChangesChunkSize;
+static std::vector<uint32_t> _mapChunkVersions;
+static uint32_t _mapChunkVersionCounter = 0;
+
+static size_t GetTileIndex(const TileCoordsXY& tilePos)
+{
+    return static_cast<size_t>(tilePos.y) * kMaximumMapSizeTechnical + tilePos.x;
+}
+
+static size_t GetChunkIndex(const TileCoordsXY& chunkPos)
+{
+    return static_cast<size_t>(chunkPos.y) * kMapChunkCount + chunkPos.x;
+}
+
+void MapChangesSetEnabled(bool enabled)
+{
+    _mapChangesEnabled = enabled;
+    MapChangesClear();
+}
+
+bool MapChangesIsEnabled()
+{
+    return _mapChangesEnabled;
+}
+
+void MapChangesMarkTile(const TileCoordsXY& tilePos)
+{
+    if (!_mapChangesEnabled)
+        return;
+
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+        return;
+
+    if (_mapChangedFlags.empty())
+    {
+        _mapChangedFlags.resize(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+    }
+
+    // Bump the chunk even if the tile is still queued, the tile may have changed again.
+    const TileCoordsXY chunkPos{ tilePos.x / kMapChangesChunkSize, tilePos.y / kMapChangesChunkSize };
+    _mapChunkVersions[GetChunkIndex(chunkPos)] = ++_mapChunkVersionCounter;
+
+    auto index = GetTileIndex(tilePos);
+    if (_mapChangedFlags[index])
+        return;
+
+    _mapChangedFlags[index] = true;
+    _mapChangedTiles.push_back(tilePos);
+}
+
+void MapChangesMarkTile(const CoordsXY& coords)
+{
+    MapChangesMarkTile(TileCoordsXY{ coords });
+}
+
+void MapChangesClear()
+{
+    _mapChangedFlags.clear();
+    _mapChangedFlags.shrink_to_fit();
+    _mapChangedTiles.clear();
+
+    // Everything may have changed, so invalidate all chunks at once.
+    _mapChunkVersions.assign(kMapChunkCount * kMapChunkCount, ++_mapChunkVersionCounter);
+}
+
+size_t MapChangesDrain(TileCoordsXY* buffer, size_t capacity)
+{
+    auto count = std::min(capacity, _mapChangedTiles.size());
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto tilePos = _mapChangedTiles.front();
+        _mapChangedTiles.pop_front();
+        _mapChangedFlags[GetTileIndex(tilePos)] = false;
+        buffer[i] = tilePos;
+    }
+    return count;
+}
+
+size_t MapChangesGetCount()
+{
+    return _mapChangedTiles.size();
+}
+
+uint32_t MapChangesGetChunkVersion(const TileCoordsXY& chunkPos)
+{
+    if (!_mapChangesEnabled)
+        return 0;
+
+    if (chunkPos.x < 0 || chunkPos.y < 0 || chunkPos.x >= kMapChunkCount || chunkPos.y >= kMapChunkCount)
+        return 0;
+
+    return _mapChunkVersions[GetChunkIndex(chunkPos)];
+}
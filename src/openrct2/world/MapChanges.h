@@ -0,0 +1,45 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Location.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Records which tiles have been modified so that hosts embedding the game can refresh only
+ * the changed parts of the map. Tracking is disabled by default and costs nothing until enabled.
+ *
+ * Tiles are marked when elements are inserted, when a tile is invalidated and at the position of
+ * every successful game action. TileElementRemove only knows the element and not its tile, so a
+ * removal outside of these paths that does not invalidate its tile is not recorded.
+ */
+void MapChangesSetEnabled(bool enabled);
+bool MapChangesIsEnabled();
+void MapChangesMarkTile(const TileCoordsXY& tilePos);
+void MapChangesMarkTile(const CoordsXY& coords);
+void MapChangesClear();
+
+/**
+ * Moves up to capacity changed tile coordinates into the buffer, in the order they were first
+ * marked, and returns how many were written. Tiles that did not fit stay queued for the next call.
+ */
+size_t MapChangesDrain(TileCoordsXY* buffer, size_t capacity);
+size_t MapChangesGetCount();
+
+/**
+ * Tiles are also grouped into square chunks that carry a version, which changes whenever a tile
+ * inside the chunk is marked. Versions only ever increase, also across map loads, so a host can
+ * compare them against the version it last built a chunk from. Returns 0 while tracking is disabled.
+ */
+constexpr int32_t kMapChangesChunkSize = 16;
+
+uint32_t MapChangesGetChunkVersion(const TileCoordsXY& chunkPos);
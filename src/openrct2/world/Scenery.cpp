@@ -129,15 +129,14 @@ void SceneryUpdateTile(const CoordsXY& sceneryPos)
     tileElement = MapGetFirstElementAt(sceneryPos);
     if (tileElement == nullptr)
         return;
+
+    // Ghosts are purely this-client-side and should not cause any interaction,
+    // as that may lead to a desync.
+    const bool skipGhosts = NetworkGetMode() != NETWORK_MODE_NONE;
     do
     {
-        // Ghosts are purely this-client-side and should not cause any interaction,
-        // as that may lead to a desync.
-        if (NetworkGetMode() != NETWORK_MODE_NONE)
-        {
-            if (tileElement->IsGhost())
-                continue;
-        }
+        if (skipGhosts && tileElement->IsGhost())
+            continue;
 
         if (tileElement->GetType() == TileElementType::SmallScenery)
         {
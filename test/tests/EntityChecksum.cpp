@@ -0,0 +1,130 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Litter.h>
+
+using namespace OpenRCT2;
+
+#ifndef DISABLE_NETWORK
+
+class EntityChecksumTest : public testing::Test
+{
+public:
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        const bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    void SetUp() override
+    {
+        ResetAllEntities();
+    }
+
+    static void TearDownTestCase()
+    {
+        ResetAllEntities();
+        _context = nullptr;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> EntityChecksumTest::_context;
+
+// Creates litter at the ids in [begin, end) with contents that only depend on the id, in reverse id order.
+static void CreateLitterRange(uint16_t begin, uint16_t end)
+{
+    for (uint16_t id = end; id-- > begin;)
+    {
+        auto* litter = CreateEntityAt<Litter>(EntityId::FromUnderlying(id));
+        ASSERT_NE(litter, nullptr);
+        litter->SubType = (id % 2) == 0 ? Litter::Type::EmptyCan : Litter::Type::Rubbish;
+        litter->creationTick = id * 7u;
+    }
+}
+
+static uint64_t GetChecksumSum(const EntitiesChecksum& checksum)
+{
+    uint64_t sum;
+    std::memcpy(&sum, checksum.raw.data(), sizeof(sum));
+    return sum;
+}
+
+TEST_F(EntityChecksumTest, UnorderedChecksumCoversNonPositionalFields)
+{
+    auto* litter = CreateEntity<Litter>();
+    ASSERT_NE(litter, nullptr);
+    litter->SubType = Litter::Type::EmptyCan;
+    litter->creationTick = 100;
+
+    const auto before = GetAllEntitiesChecksumUnordered();
+    litter->creationTick = 200;
+    const auto after = GetAllEntitiesChecksumUnordered();
+
+    EXPECT_NE(before.ToString(), after.ToString());
+}
+
+TEST_F(EntityChecksumTest, UnorderedChecksumIsStable)
+{
+    auto* litter = CreateEntity<Litter>();
+    ASSERT_NE(litter, nullptr);
+    litter->creationTick = 100;
+
+    EXPECT_EQ(GetAllEntitiesChecksumUnordered().ToString(), GetAllEntitiesChecksumUnordered().ToString());
+}
+
+TEST_F(EntityChecksumTest, UnorderedChecksumIsSumOfSeparateEntities)
+{
+    CreateLitterRange(10, 11);
+    const auto first = GetChecksumSum(GetAllEntitiesChecksumUnordered());
+
+    ResetAllEntities();
+    CreateLitterRange(20, 21);
+    const auto second = GetChecksumSum(GetAllEntitiesChecksumUnordered());
+
+    // Created in the opposite order, alongside each other.
+    ResetAllEntities();
+    CreateLitterRange(20, 21);
+    CreateLitterRange(10, 11);
+    const auto both = GetChecksumSum(GetAllEntitiesChecksumUnordered());
+
+    EXPECT_EQ(both, first + second);
+}
+
+TEST_F(EntityChecksumTest, BatchedChecksumMatchesSingleBatches)
+{
+    // More entities than fit in one batch, so the checksum is spread over the job pool.
+    CreateLitterRange(0, 3000);
+    const auto batched = GetAllEntitiesChecksumUnordered();
+    EXPECT_EQ(batched.ToString(), GetAllEntitiesChecksumUnordered().ToString());
+
+    // Each range fits in a single batch, so it is summed on the calling thread.
+    uint64_t expected = 0;
+    for (uint16_t begin = 0; begin < 3000; begin += 1000)
+    {
+        ResetAllEntities();
+        CreateLitterRange(begin, begin + 1000);
+        expected += GetChecksumSum(GetAllEntitiesChecksumUnordered());
+    }
+
+    EXPECT_EQ(GetChecksumSum(batched), expected);
+}
+
+#endif // DISABLE_NETWORK
@@ -9,12 +9,15 @@
 #include <memory>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
+#include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/Platform.h>
+#include <openrct2/scripting/ScriptEngine.h>
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Map.h>
+#include <openrct2/world/TileElementsView.h>
 #include <ostream>
 #include <string>
 
@@ -252,3 +255,113 @@ INSTANTIATE_TEST_SUITE_P(
         SimplePathfindingScenario("PathWithFences", { 11, 6, 14 }, 10000),
         SimplePathfindingScenario("PathWithCliff", { 7, 17, 14 }, 10000)),
     SimplePathfindingScenario::ToName);
+
+class PathfindingCacheTest : public PathfindingTestBase
+{
+protected:
+    static Direction ChooseDirectionForNewGuest(const TileCoordsXYZ& start, const TileCoordsXYZ& goal, RideId targetRideID)
+    {
+        auto* peep = Guest::Generate(start.ToCoordsXYZ().ToTileCentre());
+        peep->OutsideOfPark = false;
+        peep->GuestHeadingToRideId = targetRideID;
+
+        const Direction moveDir = PathFinding::ChooseDirection(start, goal, *peep, false, RideId::GetNull());
+        PeepEntityRemove(peep);
+        return moveDir;
+    }
+
+    static void SetAllPathsWide(bool isWide)
+    {
+        const auto& mapSize = GetGameState().MapSize;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                for (auto* pathElement : TileElementsView<PathElement>(TileCoordsXY{ x, y }.ToCoordsXY()))
+                {
+                    pathElement->SetWide(isWide);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(PathfindingCacheTest, WideFlagChangeInvalidatesCachedSearches)
+{
+    const TileCoordsXYZ start{ 9, 13, 14 };
+    auto ride = FindRideByName("TwoEqualRoutes");
+    ASSERT_NE(ride, nullptr);
+
+    auto entrancePos = ride->GetStation().Entrance;
+    TileCoordsXYZ goal = TileCoordsXYZ(
+        entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+
+    // Populate the cache with searches over the unmodified network.
+    PathFinding::ClearSearchCache();
+    ChooseDirectionForNewGuest(start, goal, ride->id);
+
+    // Guests avoid wide paths, so this changes what the search sees without adding or removing elements.
+    SetAllPathsWide(true);
+    ScenarioRandSeed(0x12345678, 0x87654321);
+    const Direction afterFlip = ChooseDirectionForNewGuest(start, goal, ride->id);
+
+    PathFinding::ClearSearchCache();
+    ScenarioRandSeed(0x12345678, 0x87654321);
+    const Direction uncached = ChooseDirectionForNewGuest(start, goal, ride->id);
+
+    SetAllPathsWide(false);
+
+    EXPECT_EQ(afterFlip, uncached);
+}
+
+#ifdef ENABLE_SCRIPTING
+
+TEST_F(PathfindingCacheTest, ScriptEdgeEditInvalidatesCachedSearches)
+{
+    const TileCoordsXYZ start{ 9, 13, 14 };
+    auto ride = FindRideByName("TwoEqualRoutes");
+    ASSERT_NE(ride, nullptr);
+
+    auto entrancePos = ride->GetStation().Entrance;
+    TileCoordsXYZ goal = TileCoordsXYZ(
+        entrancePos.x - TileDirectionDelta[entrancePos.direction].x,
+        entrancePos.y - TileDirectionDelta[entrancePos.direction].y, entrancePos.z);
+
+    // Populate the cache with searches over the unmodified network.
+    PathFinding::ClearSearchCache();
+    ScenarioRandSeed(0x12345678, 0x87654321);
+    const Direction before = ChooseDirectionForNewGuest(start, goal, ride->id);
+    ASSERT_NE(before, INVALID_DIRECTION);
+
+    // Disconnect the path the guest would have walked onto, in place, the way a plugin would.
+    const auto blocked = TileCoordsXY{ start.x, start.y } + TileDirectionDelta[before];
+    auto& scriptEngine = GetContext()->GetScriptEngine();
+    std::string disconnect = "var pathTestTile = map.getTile(" + std::to_string(blocked.x) + ", "
+        + std::to_string(blocked.y) + ");";
+    disconnect += "var pathTestEdges = [];"
+                  "for (var i = 0; i < pathTestTile.numElements; i++) {"
+                  "    var element = pathTestTile.getElement(i);"
+                  "    if (element.type === 'footpath') { pathTestEdges.push([i, element.edges]); element.edges = 0; }"
+                  "}";
+    scriptEngine.Eval(disconnect);
+    scriptEngine.Tick();
+
+    ScenarioRandSeed(0x12345678, 0x87654321);
+    const Direction afterEdit = ChooseDirectionForNewGuest(start, goal, ride->id);
+
+    PathFinding::ClearSearchCache();
+    ScenarioRandSeed(0x12345678, 0x87654321);
+    const Direction uncached = ChooseDirectionForNewGuest(start, goal, ride->id);
+
+    scriptEngine.Eval(
+        "for (var j = 0; j < pathTestEdges.length; j++) {"
+        "    pathTestTile.getElement(pathTestEdges[j][0]).edges = pathTestEdges[j][1];"
+        "}");
+    scriptEngine.Tick();
+
+    EXPECT_NE(afterEdit, before);
+    EXPECT_EQ(afterEdit, uncached);
+}
+
+#endif // ENABLE_SCRIPTING